@@ -50,6 +50,8 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#include "heap_4_infinitime.h"
+
 #if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
  #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
 #endif
@@ -75,6 +77,9 @@ typedef struct A_BLOCK_LINK
 {
  struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block in the list. */
  size_t xBlockSize;						/*<< The size of the free block. */
+#if( configHEAP_INSTRUMENTATION == 1 )
+ size_t xCallSite;						/*<< Index + 1 of the call site of an allocated block, 0 if untracked. */
+#endif
 } BlockLink_t;
 
 /*-----------------------------------------------------------*/
@@ -106,6 +111,13 @@ static BlockLink_t xStart, *pxEnd = NULL;
 fragmentation. */
 static size_t xFreeBytesRemaining = 0U;
 static size_t xMinimumEverFreeBytesRemaining = 0U;
+static size_t xNumberOfSuccessfulAllocations = 0U;
+static size_t xNumberOfSuccessfulFrees = 0U;
+
+#if( configHEAP_INSTRUMENTATION == 1 )
+ static HeapCallSite_t xCallSites[ heapCALL_SITES ];
+ static size_t xUntrackedAllocations = 0U;
+#endif
 
 /* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
 member of an BlockLink_t structure is set then the block belongs to the
@@ -115,7 +127,56 @@ static size_t xBlockAllocatedBit = 0;
 
 /*-----------------------------------------------------------*/
 
+#if( configHEAP_INSTRUMENTATION == 1 )
+
+static void prvRecordAllocation( BlockLink_t *pxBlock, const void *pvCallSite )
+{
+ size_t x;
+ HeapCallSite_t *pxCallSite;
+ const size_t xBlockSize = pxBlock->xBlockSize & ~xBlockAllocatedBit;
+
+ pxBlock->xCallSite = 0;
+ for( x = 0; x < heapCALL_SITES; x++ )
+ {
+   if( ( xCallSites[ x ].pvCallSite == pvCallSite ) || ( xCallSites[ x ].pvCallSite == NULL ) )
+   {
+     pxCallSite = &xCallSites[ x ];
+     pxCallSite->pvCallSite = pvCallSite;
+     pxCallSite->ulAllocations++;
+     pxCallSite->ulLiveBlocks++;
+     pxCallSite->xLiveBytes += xBlockSize;
+     if( pxCallSite->xLiveBytes > pxCallSite->xPeakLiveBytes )
+     {
+       pxCallSite->xPeakLiveBytes = pxCallSite->xLiveBytes;
+     }
+     pxBlock->xCallSite = x + 1;
+     return;
+   }
+ }
+ xUntrackedAllocations++;
+}
+
+static void prvRecordFree( BlockLink_t *pxBlock )
+{
+ HeapCallSite_t *pxCallSite;
+
+ if( pxBlock->xCallSite != 0 )
+ {
+   pxCallSite = &xCallSites[ pxBlock->xCallSite - 1 ];
+   pxCallSite->ulLiveBlocks--;
+   pxCallSite->xLiveBytes -= pxBlock->xBlockSize & ~xBlockAllocatedBit;
+ }
+}
+
 void *pvPortMalloc( size_t xWantedSize )
+{
+ return pvPortMallocFrom( xWantedSize, __builtin_return_address( 0 ) );
+}
+
+void *pvPortMallocFrom( size_t xWantedSize, const void *pvCallSite )
+#else
+void *pvPortMalloc( size_t xWantedSize )
+#endif
 {
  BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
  void *pvReturn = NULL;
@@ -233,6 +294,11 @@ void *pvPortMalloc( size_t xWantedSize )
          by the application and has no "next" block. */
          pxBlock->xBlockSize |= xBlockAllocatedBit;
          pxBlock->pxNextFreeBlock = NULL;
+         xNumberOfSuccessfulAllocations++;
+
+#if( configHEAP_INSTRUMENTATION == 1 )
+         prvRecordAllocation( pxBlock, pvCallSite );
+#endif
        }
        else
        {
@@ -302,6 +368,10 @@ void vPortFree( void *pv )
        {
          /* Add this block to the list of free blocks. */
          xFreeBytesRemaining += pxLink->xBlockSize;
+         xNumberOfSuccessfulFrees++;
+#if( configHEAP_INSTRUMENTATION == 1 )
+         prvRecordFree( pxLink );
+#endif
          traceFREE( pv, pxLink->xBlockSize );
          prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
        }
@@ -332,6 +402,98 @@ size_t xPortGetMinimumEverFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+void vPortGetHeapReport( HeapReport_t *pxHeapReport )
+{
+ BlockLink_t *pxBlock;
+ size_t xBucket, xBucketLimit;
+
+ memset( pxHeapReport, 0, sizeof( HeapReport_t ) );
+ pxHeapReport->xSizeOfSmallestFreeBlockInBytes = configTOTAL_HEAP_SIZE;
+
+ vTaskSuspendAll();
+ {
+   /* The list is only initialised by the first allocation. */
+   if( pxEnd != NULL )
+   {
+     for( pxBlock = xStart.pxNextFreeBlock; pxBlock != pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+     {
+       pxHeapReport->xNumberOfFreeBlocks++;
+       if( pxBlock->xBlockSize > pxHeapReport->xSizeOfLargestFreeBlockInBytes )
+       {
+         pxHeapReport->xSizeOfLargestFreeBlockInBytes = pxBlock->xBlockSize;
+       }
+       if( pxBlock->xBlockSize < pxHeapReport->xSizeOfSmallestFreeBlockInBytes )
+       {
+         pxHeapReport->xSizeOfSmallestFreeBlockInBytes = pxBlock->xBlockSize;
+       }
+
+       xBucketLimit = 64;
+       for( xBucket = 0; ( xBucket < heapHISTOGRAM_BUCKETS - 1 ) && ( pxBlock->xBlockSize >= xBucketLimit ); xBucket++ )
+       {
+         xBucketLimit <<= 2;
+       }
+       pxHeapReport->xFreeBlockHistogram[ xBucket ]++;
+     }
+   }
+
+   pxHeapReport->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+   pxHeapReport->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+   pxHeapReport->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+   pxHeapReport->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+ }
+ ( void ) xTaskResumeAll();
+
+ if( pxHeapReport->xNumberOfFreeBlocks == 0 )
+ {
+   pxHeapReport->xSizeOfSmallestFreeBlockInBytes = 0;
+ }
+}
+/*-----------------------------------------------------------*/
+
+#if( configHEAP_INSTRUMENTATION == 1 )
+
+size_t uxPortGetHeapCallSites( HeapCallSite_t *pxCallSites, size_t uxMaxCallSites )
+{
+ HeapCallSite_t xCallSite;
+ size_t x, y, uxCount = 0;
+
+ vTaskSuspendAll();
+ {
+   /* Insertion sort, by decreasing live bytes, keeping the first uxMaxCallSites. */
+   for( x = 0; ( x < heapCALL_SITES ) && ( xCallSites[ x ].pvCallSite != NULL ); x++ )
+   {
+     xCallSite = xCallSites[ x ];
+     for( y = uxCount; ( y > 0 ) && ( pxCallSites[ y - 1 ].xLiveBytes < xCallSite.xLiveBytes ); y-- )
+     {
+       if( y < uxMaxCallSites )
+       {
+         pxCallSites[ y ] = pxCallSites[ y - 1 ];
+       }
+     }
+     if( y < uxMaxCallSites )
+     {
+       pxCallSites[ y ] = xCallSite;
+       if( uxCount < uxMaxCallSites )
+       {
+         uxCount++;
+       }
+     }
+   }
+ }
+ ( void ) xTaskResumeAll();
+
+ return uxCount;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetUntrackedAllocations( void )
+{
+ return xUntrackedAllocations;
+}
+/*-----------------------------------------------------------*/
+
+#endif
+
 void vPortInitialiseBlocks( void )
 {
  /* This just exists to keep the linker quiet. */
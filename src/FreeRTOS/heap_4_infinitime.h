@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <FreeRTOS.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of buckets of the free block histogram. Bucket i counts the free
+blocks smaller than 64 << (2 * i) bytes (header included), the last bucket
+counts all the larger ones: < 64, < 256, < 1K, < 4K, >= 4K. */
+#define heapHISTOGRAM_BUCKETS 5
+
+/* Same fields as HeapStats_t in the later FreeRTOS versions, and the
+histogram of the free block sizes. */
+typedef struct xHEAP_REPORT
+{
+ size_t xAvailableHeapSpaceInBytes;
+ size_t xSizeOfLargestFreeBlockInBytes;
+ size_t xSizeOfSmallestFreeBlockInBytes;
+ size_t xNumberOfFreeBlocks;
+ size_t xMinimumEverFreeBytesRemaining;
+ size_t xNumberOfSuccessfulAllocations;
+ size_t xNumberOfSuccessfulFrees;
+ size_t xFreeBlockHistogram[ heapHISTOGRAM_BUCKETS ];
+} HeapReport_t;
+
+/* Walks the list of free blocks with the scheduler suspended. */
+void vPortGetHeapReport( HeapReport_t *pxHeapReport );
+
+void *pvPortRealloc( void *pv, size_t xWantedSize );
+
+#if( configHEAP_INSTRUMENTATION == 1 )
+ /* Number of call sites tracked. The allocations from the other call sites
+ are only counted in xUntrackedAllocations. */
+ #define heapCALL_SITES 24
+
+ typedef struct xHEAP_CALL_SITE
+ {
+  const void *pvCallSite;		/*<< Return address of the call to malloc(), new or pvPortMalloc(). */
+  uint32_t ulAllocations;		/*<< Number of allocations since boot. */
+  uint32_t ulLiveBlocks;		/*<< Number of blocks not freed yet. */
+  size_t xLiveBytes;			/*<< Size of these blocks, header included. */
+  size_t xPeakLiveBytes;
+ } HeapCallSite_t;
+
+ /* Same as pvPortMalloc(), with the call site to which the allocation is accounted. */
+ void *pvPortMallocFrom( size_t xWantedSize, const void *pvCallSite );
+
+ /* Copies up to uxMaxCallSites call sites, the ones that hold the most
+ memory first, and returns the number of call sites copied. */
+ size_t uxPortGetHeapCallSites( HeapCallSite_t *pxCallSites, size_t uxMaxCallSites );
+
+ size_t xPortGetUntrackedAllocations( void );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -82,6 +82,11 @@
 #define configCHECK_FOR_STACK_OVERFLOW 1
 #define configUSE_MALLOC_FAILED_HOOK   1
 
+/* Per call site heap accounting, see heap_4_infinitime.h. Enabled with -DHEAP_INSTRUMENTATION=1 */
+#ifndef configHEAP_INSTRUMENTATION
+  #define configHEAP_INSTRUMENTATION 0
+#endif
+
 /* Run time and task stats gathering related definitions. */
 #define configGENERATE_RUN_TIME_STATS        0
 #define configUSE_TRACE_FACILITY             1
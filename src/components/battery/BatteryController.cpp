@@ -10,12 +10,14 @@ using namespace Pinetime::Controllers;
 
 Battery* Battery::instance = nullptr;
 
-Battery::Battery() {
+Battery::Battery(ChangeNotifier& changeNotifier) : changeNotifier {changeNotifier} {
   instance = this;
   nrf_gpio_cfg_input(PinMap::Charging, static_cast<nrf_gpio_pin_pull_t> GPIO_PIN_CNF_PULL_Disabled);
 }
 
 void Battery::ReadPowerState() {
+  const bool wasCharging = IsCharging();
+  const bool wasPowerPresent = isPowerPresent;
   isCharging = (nrf_gpio_pin_read(PinMap::Charging) == 0);
   isPowerPresent = (nrf_gpio_pin_read(PinMap::PowerPresent) == 0);
 
@@ -24,6 +26,10 @@ void Battery::ReadPowerState() {
   } else if (!isPowerPresent) {
     isFull = false;
   }
+
+  if (IsCharging() != wasCharging || isPowerPresent != wasPowerPresent) {
+    changeNotifier.Publish(ChangeNotifier::Topic::Battery);
+  }
 }
 
 void Battery::MeasureVoltage() {
@@ -85,6 +91,7 @@ void Battery::SaadcEventHandler(nrfx_saadc_evt_t const* p_event) {
       firstMeasurement = false;
       percentRemaining = newPercent;
       systemTask->PushMessage(System::Messages::BatteryPercentageUpdated);
+      changeNotifier.Publish(ChangeNotifier::Topic::Battery);
     }
 
     nrfx_saadc_uninit();
@@ -1,4 +1,6 @@
 #include "components/ble/DfuService.h"
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include "components/ble/BleController.h"
 #include "drivers/SpiNorFlash.h"
@@ -12,6 +14,21 @@ constexpr ble_uuid128_t DfuService::controlPointCharacteristicUuid;
 constexpr ble_uuid128_t DfuService::revisionCharacteristicUuid;
 constexpr ble_uuid128_t DfuService::packetCharacteristicUuid;
 
+namespace {
+  // CRC-16/CCITT (polynomial 0x1021), one table lookup per byte
+  constexpr std::array<uint16_t, 256> crcTable = []() {
+    std::array<uint16_t, 256> table {};
+    for (uint16_t i = 0; i < table.size(); i++) {
+      uint16_t crc = i << 8;
+      for (int bit = 0; bit < 8; bit++) {
+        crc = (crc & 0x8000u) ? (crc << 1) ^ 0x1021u : crc << 1;
+      }
+      table[i] = crc;
+    }
+    return table;
+  }();
+}
+
 int DfuServiceCallback(uint16_t conn_handle, uint16_t attr_handle, struct ble_gatt_access_ctxt* ctxt, void* arg) {
   auto dfuService = static_cast<DfuService*>(arg);
   return dfuService->OnServiceData(conn_handle, attr_handle, ctxt);
@@ -32,7 +49,7 @@ DfuService::DfuService(Pinetime::System::SystemTask& systemTask,
                        Pinetime::Drivers::SpiNorFlash& spiNorFlash)
   : systemTask {systemTask},
     bleController {bleController},
-    dfuImage {spiNorFlash},
+    dfuImage {systemTask, spiNorFlash},
     characteristicDefinition {{
                                 .uuid = &packetCharacteristicUuid.u,
                                 .access_cb = DfuServiceCallback,
@@ -129,8 +146,6 @@ int DfuService::WritePacketHandler(uint16_t connectionHandle, os_mbuf* om) {
         vTaskDelay(50); // 50ms
       }
 
-      dfuImage.Erase();
-
       uint8_t data[] {16, 1, 1};
       notificationManager.Send(connectionHandle, controlPointCharacteristicHandle, data, 3);
       state = States::Init;
@@ -300,6 +315,10 @@ void DfuService::OnTimeout() {
   Reset();
 }
 
+void DfuService::WritePendingData() {
+  dfuImage.WritePendingData();
+}
+
 void DfuService::Reset() {
   state = States::Idle;
   nbPacketsToNotify = 0;
@@ -350,12 +369,26 @@ void DfuService::NotificationManager::Reset() {
   xTimerStop(timer, 0);
 }
 
+DfuService::DfuImage::DfuImage(Pinetime::System::SystemTask& systemTask, Pinetime::Drivers::SpiNorFlash& spiNorFlash)
+  : systemTask {systemTask}, spiNorFlash {spiNorFlash} {
+  bufferWritten = xSemaphoreCreateBinary();
+  xSemaphoreGive(bufferWritten);
+}
+
 void DfuService::DfuImage::Init(size_t chunkSize, size_t totalSize, uint16_t expectedCrc) {
   if (chunkSize != 20)
     return;
+  // A buffer from a previous, aborted, update might still be written
+  WaitForPendingData();
   this->chunkSize = chunkSize;
   this->totalSize = totalSize;
   this->expectedCrc = expectedCrc;
+  bufferWriteIndex = 0;
+  totalWriteIndex = 0;
+  erasedSize = 0;
+  crc = 0xFFFF;
+  writeFailed = false;
+  fillBuffer = buffers[0];
   this->ready = true;
 }
 
@@ -364,20 +397,74 @@ void DfuService::DfuImage::Append(uint8_t* data, size_t size) {
     return;
   ASSERT(size <= 20);
 
-  std::memcpy(tempBuffer + bufferWriteIndex, data, size);
-  bufferWriteIndex += size;
+  while (size > 0) {
+    size_t toCopy = std::min(size, bufferSize - bufferWriteIndex);
+    std::memcpy(fillBuffer + bufferWriteIndex, data, toCopy);
+    bufferWriteIndex += toCopy;
+    data += toCopy;
+    size -= toCopy;
+
+    if (bufferWriteIndex == bufferSize || totalWriteIndex + bufferWriteIndex == totalSize) {
+      SubmitBuffer();
+    }
+  }
+}
+
+void DfuService::DfuImage::SubmitBuffer() {
+  // Wait for the other buffer to be written before handing over this one
+  xSemaphoreTake(bufferWritten, portMAX_DELAY);
+  pendingData = fillBuffer;
+  pendingOffset = totalWriteIndex;
+  pendingSize = bufferWriteIndex;
+  systemTask.PushMessage(Pinetime::System::Messages::BleFirmwareUpdateWrite);
+
+  totalWriteIndex += bufferWriteIndex;
+  bufferWriteIndex = 0;
+  fillBuffer = (fillBuffer == buffers[0]) ? buffers[1] : buffers[0];
+}
+
+void DfuService::DfuImage::WritePendingData() {
+  if (pendingSize == 0) {
+    return;
+  }
 
-  if (bufferWriteIndex == bufferSize) {
-    spiNorFlash.Write(writeOffset + totalWriteIndex, tempBuffer, bufferWriteIndex);
-    totalWriteIndex += bufferWriteIndex;
-    bufferWriteIndex = 0;
+  // Also erase the sector the next buffer will be written to, while it's being received
+  EraseUntil(std::min(pendingOffset + pendingSize + bufferSize, totalSize));
+  spiNorFlash.Write(writeOffset + pendingOffset, pendingData, pendingSize);
+  if (!VerifyWrite(writeOffset + pendingOffset, pendingData, pendingSize)) {
+    writeFailed = true;
   }
+  crc = ComputeCrc(pendingData, pendingSize, &crc);
 
-  if (bufferWriteIndex > 0 && totalWriteIndex + bufferWriteIndex == totalSize) {
-    spiNorFlash.Write(writeOffset + totalWriteIndex, tempBuffer, bufferWriteIndex);
-    totalWriteIndex += bufferWriteIndex;
-    if (totalSize < maxSize)
-      WriteMagicNumber();
+  if (pendingOffset + pendingSize == totalSize && totalSize < maxSize) {
+    WriteMagicNumber();
+  }
+
+  pendingSize = 0;
+  xSemaphoreGive(bufferWritten);
+}
+
+void DfuService::DfuImage::WaitForPendingData() {
+  xSemaphoreTake(bufferWritten, portMAX_DELAY);
+  xSemaphoreGive(bufferWritten);
+}
+
+bool DfuService::DfuImage::VerifyWrite(size_t offset, const uint8_t* data, size_t size) {
+  uint8_t readBack[32];
+  for (size_t verified = 0; verified < size; verified += sizeof(readBack)) {
+    size_t readSize = std::min(size - verified, sizeof(readBack));
+    spiNorFlash.Read(offset + verified, readBack, readSize);
+    if (std::memcmp(readBack, data + verified, readSize) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void DfuService::DfuImage::EraseUntil(size_t offset) {
+  while (erasedSize < offset) {
+    spiNorFlash.SectorErase(writeOffset + erasedSize);
+    erasedSize += sectorSize;
   }
 }
 
@@ -391,45 +478,24 @@ void DfuService::DfuImage::WriteMagicNumber() {
   };
 
   uint32_t offset = writeOffset + (maxSize - (4 * sizeof(uint32_t)));
-  spiNorFlash.Write(offset, reinterpret_cast<const uint8_t*>(magic), 4 * sizeof(uint32_t));
-}
-
-void DfuService::DfuImage::Erase() {
-  for (size_t erased = 0; erased < maxSize; erased += 0x1000) {
-    spiNorFlash.SectorErase(writeOffset + erased);
+  // The image doesn't reach the last sector, which holds the magic number
+  if (erasedSize < maxSize) {
+    spiNorFlash.SectorErase(writeOffset + maxSize - sectorSize);
   }
+  spiNorFlash.Write(offset, reinterpret_cast<const uint8_t*>(magic), 4 * sizeof(uint32_t));
 }
 
 bool DfuService::DfuImage::Validate() {
-  uint32_t chunkSize = 200;
-  size_t currentOffset = 0;
-  uint16_t crc = 0;
-
-  bool first = true;
-  while (currentOffset < totalSize) {
-    uint32_t readSize = (totalSize - currentOffset) > chunkSize ? chunkSize : (totalSize - currentOffset);
-
-    spiNorFlash.Read(writeOffset + currentOffset, tempBuffer, readSize);
-    if (first) {
-      crc = ComputeCrc(tempBuffer, readSize, NULL);
-      first = false;
-    } else
-      crc = ComputeCrc(tempBuffer, readSize, &crc);
-    currentOffset += readSize;
-  }
-
-  return (crc == expectedCrc);
+  // The CRC is computed as the buffers are written, and each of them is read back right after being programmed
+  WaitForPendingData();
+  return !writeFailed && crc == expectedCrc;
 }
 
 uint16_t DfuService::DfuImage::ComputeCrc(uint8_t const* p_data, uint32_t size, uint16_t const* p_crc) {
   uint16_t crc = (p_crc == NULL) ? 0xFFFF : *p_crc;
 
   for (uint32_t i = 0; i < size; i++) {
-    crc = static_cast<uint8_t>(crc >> 8) | (crc << 8);
-    crc ^= p_data[i];
-    crc ^= static_cast<uint8_t>(crc & 0xFF) >> 4;
-    crc ^= (crc << 8) << 4;
-    crc ^= ((crc & 0xFF) << 4) << 1;
+    crc = (crc << 8) ^ crcTable[(crc >> 8) ^ p_data[i]];
   }
 
   return crc;
@@ -2,6 +2,9 @@
 
 #include <cstdint>
 #include <array>
+#include <FreeRTOS.h>
+#include <semphr.h>
+#include <timers.h>
 
 #define min // workaround: nimble's min/max macros conflict with libstdc++
 #define max
@@ -30,6 +33,7 @@ namespace Pinetime {
       int OnServiceData(uint16_t connectionHandle, uint16_t attributeHandle, ble_gatt_access_ctxt* context);
       void OnTimeout();
       void Reset();
+      void WritePendingData();
 
       class NotificationManager {
       public:
@@ -49,30 +53,52 @@ namespace Pinetime {
         void Reset();
       };
 
+      // Firmware image written to the external flash. Packets received from BLE are copied into one buffer
+      // while the other one is programmed by SystemTask (see WritePendingData()), and sectors are erased
+      // just before the data reaches them instead of all at once when the update starts.
       class DfuImage {
       public:
-        DfuImage(Pinetime::Drivers::SpiNorFlash& spiNorFlash) : spiNorFlash {spiNorFlash} {
-        }
+        DfuImage(Pinetime::System::SystemTask& systemTask, Pinetime::Drivers::SpiNorFlash& spiNorFlash);
 
         void Init(size_t chunkSize, size_t totalSize, uint16_t expectedCrc);
-        void Erase();
         void Append(uint8_t* data, size_t size);
+        void WritePendingData();
         bool Validate();
         bool IsComplete();
 
       private:
+        Pinetime::System::SystemTask& systemTask;
         Pinetime::Drivers::SpiNorFlash& spiNorFlash;
-        static constexpr size_t bufferSize = 200;
+        // One flash page, so that each buffer is programmed in a single operation
+        static constexpr size_t bufferSize = 256;
+        static constexpr size_t sectorSize = 0x1000;
         bool ready = false;
         size_t chunkSize = 0;
         size_t totalSize = 0;
-        size_t maxSize = 475136;
+        static constexpr size_t maxSize = 475136;
         size_t bufferWriteIndex = 0;
         size_t totalWriteIndex = 0;
         static constexpr size_t writeOffset = 0x40000;
-        uint8_t tempBuffer[bufferSize];
+        uint8_t buffers[2][bufferSize];
+        uint8_t* fillBuffer = buffers[0];
         uint16_t expectedCrc = 0;
 
+        // Buffer handed over to SystemTask. bufferWritten is given once it's programmed,
+        // so at most one buffer is waiting to be written while the other one is filled.
+        const uint8_t* pendingData = nullptr;
+        size_t pendingOffset = 0;
+        size_t pendingSize = 0;
+        SemaphoreHandle_t bufferWritten;
+        size_t erasedSize = 0;
+
+        // CRC of the data written so far, and whether reading it back from the flash showed a difference
+        uint16_t crc = 0xFFFF;
+        bool writeFailed = false;
+
+        void SubmitBuffer();
+        void WaitForPendingData();
+        void EraseUntil(size_t offset);
+        bool VerifyWrite(size_t offset, const uint8_t* data, size_t size);
         void WriteMagicNumber();
         uint16_t ComputeCrc(uint8_t const* p_data, uint32_t size, uint16_t const* p_crc);
       };
@@ -26,7 +26,7 @@ FSService::FSService(Pinetime::System::SystemTask& systemTask, Pinetime::Control
                                 .uuid = &fsTransferUuid.u,
                                 .access_cb = FSServiceCallback,
                                 .arg = this,
-                                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY,
+                                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_WRITE_NO_RSP | BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY,
                                 .val_handle = &transferCharacteristicHandle,
                               },
                               {0}},
@@ -64,14 +64,12 @@ int FSService::FSCommandHandler(uint16_t connectionHandle, os_mbuf* om) {
   auto command = static_cast<commands>(om->om_data[0]);
   NRF_LOG_INFO("[FS_S] -> FSCommandHandler Command %d", command);
   // Just always make sure we are awake...
-  systemTask.PushMessage(Pinetime::System::Messages::StartFileTransfer);
-  vTaskDelay(10);
-  while (systemTask.IsSleeping()) {
-    vTaskDelay(100); // 50ms
+  WakeUpSystem();
+  if (command != commands::WRITE_DATA) {
+    CloseWriteFile();
   }
   lfs_dir_t dir = {0};
   lfs_info info = {0};
-  lfs_file f = {0};
   switch (command) {
     case commands::READ: {
       NRF_LOG_INFO("[FS_S] -> Read");
@@ -82,62 +80,17 @@ int FSService::FSCommandHandler(uint16_t connectionHandle, os_mbuf* om) {
       }
       memcpy(filepath, header->pathstr, plen);
       filepath[plen] = 0; // Copy and null terminate string
-      ReadResponse resp;
-      os_mbuf* om;
-      resp.command = commands::READ_DATA;
-      resp.status = 0x01;
-      resp.chunkoff = header->chunkoff;
-      int res = fs.Stat(filepath, &info);
-      if (res == LFS_ERR_NOENT && info.type != LFS_TYPE_DIR) {
-        resp.status = (int8_t) res;
-        resp.chunklen = 0;
-        resp.totallen = 0;
-        om = ble_hs_mbuf_from_flat(&resp, sizeof(ReadResponse));
-      } else {
-        resp.chunklen = std::min(header->chunksize, info.size); // TODO add mtu somehow
-        resp.totallen = info.size;
-        fs.FileOpen(&f, filepath, LFS_O_RDONLY);
-        fs.FileSeek(&f, header->chunkoff);
-        uint8_t fileData[resp.chunklen] = {0};
-        resp.chunklen = fs.FileRead(&f, fileData, resp.chunklen);
-        om = ble_hs_mbuf_from_flat(&resp, sizeof(ReadResponse));
-        os_mbuf_append(om, fileData, resp.chunklen);
-        fs.FileClose(&f);
-      }
-
-      ble_gattc_notify_custom(connectionHandle, transferCharacteristicHandle, om);
+      SendReadData(connectionHandle, header->chunkoff, header->chunksize);
       break;
     }
     case commands::READ_PACING: {
       NRF_LOG_INFO("[FS_S] -> Readpacing");
-      auto* header = (ReadHeader*) om->om_data;
-      ReadResponse resp;
-      resp.command = commands::READ_DATA;
-      resp.status = 0x01;
-      resp.chunkoff = header->chunkoff;
-      int res = fs.Stat(filepath, &info);
-      if (res == LFS_ERR_NOENT && info.type != LFS_TYPE_DIR) {
-        resp.status = (int8_t) res;
-        resp.chunklen = 0;
-        resp.totallen = 0;
-      } else {
-        resp.chunklen = std::min(header->chunksize, info.size); // TODO add mtu somehow
-        resp.totallen = info.size;
-        fs.FileOpen(&f, filepath, LFS_O_RDONLY);
-        fs.FileSeek(&f, header->chunkoff);
-      }
-      os_mbuf* om;
-      if (resp.chunklen > 0) {
-        uint8_t fileData[resp.chunklen] = {0};
-        resp.chunklen = fs.FileRead(&f, fileData, resp.chunklen);
-        om = ble_hs_mbuf_from_flat(&resp, sizeof(ReadResponse));
-        os_mbuf_append(om, fileData, resp.chunklen);
-      } else {
-        resp.chunklen = 0;
-        om = ble_hs_mbuf_from_flat(&resp, sizeof(ReadResponse));
+      auto* header = (ReadPacing*) om->om_data;
+      if (header->chunkoff > readBurstStart && header->chunkoff < readBurstEnd) {
+        // Acknowledges a notification of the current burst, the data is already on its way
+        break;
       }
-      fs.FileClose(&f);
-      ble_gattc_notify_custom(connectionHandle, transferCharacteristicHandle, om);
+      SendReadData(connectionHandle, header->chunkoff, header->chunksize);
       break;
     }
     case commands::WRITE: {
@@ -155,10 +108,13 @@ int FSService::FSCommandHandler(uint16_t connectionHandle, os_mbuf* om) {
       resp.offset = header->offset;
       resp.modTime = 0;
 
-      int res = fs.FileOpen(&f, filepath, LFS_O_RDWR | LFS_O_CREAT);
-      if (res == 0) {
-        fs.FileClose(&f);
-        resp.status = (res == 0) ? 0x01 : (int8_t) res;
+      int res = fs.FileOpen(&writeFile, filepath, LFS_O_RDWR | LFS_O_CREAT);
+      resp.status = (res == 0) ? 0x01 : (int8_t) res;
+      writeFileOpen = (res == 0);
+      writeBufferOffset = header->offset;
+      writeBufferLength = 0;
+      if (fileSize <= static_cast<int>(header->offset)) {
+        CloseWriteFile();
       }
       resp.freespace = std::min(fs.getSize() - (fs.GetFSSize() * fs.getBlockSize()), fileSize - header->offset);
       auto* om = ble_hs_mbuf_from_flat(&resp, sizeof(WriteResponse));
@@ -170,15 +126,11 @@ int FSService::FSCommandHandler(uint16_t connectionHandle, os_mbuf* om) {
       auto* header = (WritePacing*) om->om_data;
       WriteResponse resp;
       resp.command = commands::WRITE_PACING;
+      resp.status = 0x01;
       resp.offset = header->offset;
-      int res = 0;
+      resp.modTime = 0;
 
-      if (!(res = fs.FileOpen(&f, filepath, LFS_O_RDWR | LFS_O_CREAT))) {
-        if ((res = fs.FileSeek(&f, header->offset)) >= 0) {
-          res = fs.FileWrite(&f, header->data, header->dataSize);
-        }
-        fs.FileClose(&f);
-      }
+      int res = WriteData(header->offset, header->data, header->dataSize);
       if (res < 0) {
         resp.status = (int8_t) res;
       }
@@ -328,3 +280,141 @@ void FSService::prepareReadDataResp(ReadHeader* header, ReadResponse* resp) {
     fs.FileClose(&f);
   }
 }
+
+void FSService::Reset() {
+  if (writeFileOpen) {
+    // A stalled transfer lets the system go to sleep, with the flash powered down
+    WakeUpSystem();
+    CloseWriteFile();
+    systemTask.PushMessage(Pinetime::System::Messages::StopFileTransfer);
+  }
+  readBurstStart = readBurstEnd = 0;
+}
+
+void FSService::WakeUpSystem() {
+  systemTask.PushMessage(Pinetime::System::Messages::StartFileTransfer);
+  while (systemTask.IsSleeping()) {
+    vTaskDelay(100); // 50ms
+  }
+}
+
+uint16_t FSService::MaxReadChunkSize(uint16_t connectionHandle) const {
+  // A notification carries at most MTU - 3 bytes, including the response header
+  const uint16_t mtu = std::max<uint16_t>(ble_att_mtu(connectionHandle), BLE_ATT_MTU_DFLT);
+  return std::min<uint16_t>(mtu - 3, maxNotificationSize) - sizeof(ReadResponse);
+}
+
+// Sends the requested data in as many READ_DATA notifications as needed, up to maxNotificationsPerRead
+void FSService::SendReadData(uint16_t connectionHandle, uint32_t offset, uint32_t length) {
+  ReadResponse resp;
+  resp.command = commands::READ_DATA;
+  resp.status = 0x01;
+  resp.chunkoff = offset;
+  lfs_info info = {0};
+  int res = fs.Stat(filepath, &info);
+  if (res == LFS_ERR_NOENT && info.type != LFS_TYPE_DIR) {
+    resp.status = (int8_t) res;
+    resp.chunklen = 0;
+    resp.totallen = 0;
+    auto* om = ble_hs_mbuf_from_flat(&resp, sizeof(ReadResponse));
+    ble_gattc_notify_custom(connectionHandle, transferCharacteristicHandle, om);
+    return;
+  }
+
+  resp.totallen = info.size;
+  uint32_t remaining = (offset < info.size) ? std::min(length, info.size - offset) : 0;
+  const uint16_t chunkSize = MaxReadChunkSize(connectionHandle);
+  lfs_file f;
+  fs.FileOpen(&f, filepath, LFS_O_RDONLY);
+  fs.FileSeek(&f, offset);
+
+  readBurstStart = offset;
+  readBurstEnd = offset;
+  uint8_t nbNotifications = 0;
+  do {
+    std::array<uint8_t, maxReadChunkSize> fileData;
+    int read = (remaining > 0) ? fs.FileRead(&f, fileData.data(), std::min<uint32_t>(remaining, chunkSize)) : 0;
+    resp.chunkoff = readBurstEnd;
+    resp.chunklen = std::max(read, 0);
+    auto* om = ble_hs_mbuf_from_flat(&resp, sizeof(ReadResponse));
+    if (om == nullptr) {
+      break;
+    }
+    os_mbuf_append(om, fileData.data(), resp.chunklen);
+    if (ble_gattc_notify_custom(connectionHandle, transferCharacteristicHandle, om) != 0) {
+      // Out of buffers: the client will ask for the rest with its next pacing request
+      break;
+    }
+    readBurstEnd += resp.chunklen;
+    remaining -= resp.chunklen;
+    nbNotifications++;
+    if (resp.chunklen == 0) {
+      break;
+    }
+  } while (remaining > 0 && nbNotifications < maxNotificationsPerRead);
+  fs.FileClose(&f);
+}
+
+// Appends the data to the write buffer, which is programmed when it is full or when the transfer completes
+int FSService::WriteData(uint32_t offset, const uint8_t* data, uint32_t size) {
+  if (!writeFileOpen) {
+    int res = fs.FileOpen(&writeFile, filepath, LFS_O_RDWR | LFS_O_CREAT);
+    if (res < 0) {
+      return res;
+    }
+    writeFileOpen = true;
+    writeBufferOffset = offset;
+    writeBufferLength = 0;
+  }
+
+  if (offset != writeBufferOffset + writeBufferLength) {
+    // Not contiguous with the buffered data
+    int res = FlushWriteBuffer();
+    if (res < 0) {
+      return res;
+    }
+    writeBufferOffset = offset;
+  }
+
+  while (size > 0) {
+    const uint32_t length = std::min<uint32_t>(size, writeBuffer.size() - writeBufferLength);
+    memcpy(writeBuffer.data() + writeBufferLength, data, length);
+    writeBufferLength += length;
+    data += length;
+    size -= length;
+    if (writeBufferLength == writeBuffer.size()) {
+      int res = FlushWriteBuffer();
+      if (res < 0) {
+        return res;
+      }
+    }
+  }
+
+  if (writeBufferOffset + writeBufferLength >= static_cast<uint32_t>(fileSize)) {
+    return CloseWriteFile();
+  }
+  return 0;
+}
+
+int FSService::FlushWriteBuffer() {
+  if (writeBufferLength == 0) {
+    return 0;
+  }
+  int res = fs.FileSeek(&writeFile, writeBufferOffset);
+  if (res >= 0) {
+    res = fs.FileWrite(&writeFile, writeBuffer.data(), writeBufferLength);
+  }
+  writeBufferOffset += writeBufferLength;
+  writeBufferLength = 0;
+  return (res < 0) ? res : 0;
+}
+
+int FSService::CloseWriteFile() {
+  if (!writeFileOpen) {
+    return 0;
+  }
+  int res = FlushWriteBuffer();
+  int closeRes = fs.FileClose(&writeFile);
+  writeFileOpen = false;
+  return (res < 0) ? res : closeRes;
+}
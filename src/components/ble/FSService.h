@@ -2,9 +2,11 @@
 #define min // workaround: nimble's min/max macros conflict with libstdc++
 #define max
 #include <host/ble_gap.h>
+#include <host/ble_att.h>
 #undef max
 #undef min
 
+#include <array>
 #include "components/fs/FS.h"
 
 namespace Pinetime {
@@ -22,6 +24,7 @@ namespace Pinetime {
 
       int OnFSServiceRequested(uint16_t connectionHandle, uint16_t attributeHandle, ble_gatt_access_ctxt* context);
       void NotifyFSRaw(uint16_t connectionHandle);
+      void Reset();
 
     private:
       Pinetime::System::SystemTask& systemTask;
@@ -190,8 +193,37 @@ namespace Pinetime {
         uint8_t status;
       };
 
+      // Largest notification payload with the largest MTU NimBLE accepts
+      static constexpr uint16_t maxNotificationSize = MYNEWT_VAL(BLE_ATT_PREFERRED_MTU) - 3;
+      static constexpr uint16_t maxReadChunkSize = maxNotificationSize - sizeof(ReadResponse);
+      // When the client asks for more data than a single notification can carry, up to this
+      // many READ_DATA notifications are queued for a single READ or READ_PACING request.
+      static constexpr uint8_t maxNotificationsPerRead = 4;
+      // Incoming chunks are buffered so that littlefs gets a few large writes instead of one per chunk.
+      // littlefs still programs the flash by cache_size (64 bytes) at a time.
+      static constexpr uint16_t writeBufferSize = 256;
+
+      // Data sent for the last READ or READ_PACING request. The client may acknowledge each notification:
+      // only the pacing requests that don't fall inside the burst trigger the next one.
+      uint32_t readBurstStart = 0;
+      uint32_t readBurstEnd = 0;
+
+      // The file being written stays open until the transfer completes or another command is received
+      lfs_file_t writeFile;
+      bool writeFileOpen = false;
+      std::array<uint8_t, writeBufferSize> writeBuffer;
+      uint16_t writeBufferLength = 0;
+      uint32_t writeBufferOffset = 0;
+
       int FSCommandHandler(uint16_t connectionHandle, os_mbuf* om);
       void prepareReadDataResp(ReadHeader* header, ReadResponse* resp);
+      uint16_t MaxReadChunkSize(uint16_t connectionHandle) const;
+      void SendReadData(uint16_t connectionHandle, uint32_t offset, uint32_t length);
+      int WriteData(uint32_t offset, const uint8_t* data, uint32_t size);
+      int FlushWriteBuffer();
+      int CloseWriteFile();
+      // Blocks until the system is running, so that the flash is awake
+      void WakeUpSystem();
     };
   }
 }
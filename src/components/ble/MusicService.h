@@ -17,8 +17,9 @@
 */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <string>
+#include "utility/VersionedString.h"
 #define min // workaround: nimble's min/max macros conflict with libstdc++
 #define max
 #include <host/ble_gap.h>
@@ -40,11 +41,15 @@ namespace Pinetime {
 
       void event(char event);
 
-      std::string getArtist() const;
+      static constexpr size_t maxStringSize = 40;
+      using Text = Utility::VersionedString<maxStringSize>;
 
-      std::string getTrack() const;
+      // The texts are updated in place: compare their Version() to know when they change
+      const Text& getArtist() const;
 
-      std::string getAlbum() const;
+      const Text& getTrack() const;
+
+      const Text& getAlbum() const;
 
       int getProgress() const;
 
@@ -70,9 +75,9 @@ namespace Pinetime {
 
       uint16_t eventHandle {};
 
-      std::string artistName {"Waiting for"};
-      std::string albumName {};
-      std::string trackName {"track information.."};
+      Text artistName {"Waiting for"};
+      Text albumName {};
+      Text trackName {"track information.."};
 
       bool playing {false};
 
@@ -17,6 +17,7 @@
 */
 
 #include "components/ble/NavigationService.h"
+#include <cstring>
 
 namespace {
   // 0001yyxx-78fc-48fe-8e23-433b3a1942d0
@@ -83,16 +84,21 @@ int Pinetime::Controllers::NavigationService::OnCommand(struct ble_gatt_access_c
 
   if (ctxt->op == BLE_GATT_ACCESS_OP_WRITE_CHR) {
     size_t notifSize = OS_MBUF_PKTLEN(ctxt->om);
-    uint8_t data[notifSize + 1];
-    data[notifSize] = '\0';
-    os_mbuf_copydata(ctxt->om, 0, notifSize, data);
-    char* s = (char*) &data[0];
+    // One byte more than the capacity of the longest string, so that Assign() knows when to truncate it
+    uint8_t data[maxNarrativeSize + 1] {};
+    size_t bufferSize = notifSize;
+    if (bufferSize > sizeof(data)) {
+      bufferSize = sizeof(data);
+    }
+    os_mbuf_copydata(ctxt->om, 0, bufferSize, data);
+    const char* s = reinterpret_cast<const char*>(&data[0]);
+    const std::string_view text {s, strnlen(s, bufferSize)};
     if (ble_uuid_cmp(ctxt->chr->uuid, &navFlagCharUuid.u) == 0) {
-      m_flag = s;
+      m_flag.Assign(text);
     } else if (ble_uuid_cmp(ctxt->chr->uuid, &navNarrativeCharUuid.u) == 0) {
-      m_narrative = s;
+      m_narrative.Assign(text);
     } else if (ble_uuid_cmp(ctxt->chr->uuid, &navManDistCharUuid.u) == 0) {
-      m_manDist = s;
+      m_manDist.Assign(text);
     } else if (ble_uuid_cmp(ctxt->chr->uuid, &navProgressCharUuid.u) == 0) {
       m_progress = data[0];
     }
@@ -100,15 +106,15 @@ int Pinetime::Controllers::NavigationService::OnCommand(struct ble_gatt_access_c
   return 0;
 }
 
-std::string Pinetime::Controllers::NavigationService::getFlag() {
+const Pinetime::Controllers::NavigationService::Flag& Pinetime::Controllers::NavigationService::getFlag() const {
   return m_flag;
 }
 
-std::string Pinetime::Controllers::NavigationService::getNarrative() {
+const Pinetime::Controllers::NavigationService::Narrative& Pinetime::Controllers::NavigationService::getNarrative() const {
   return m_narrative;
 }
 
-std::string Pinetime::Controllers::NavigationService::getManDist() {
+const Pinetime::Controllers::NavigationService::ManDist& Pinetime::Controllers::NavigationService::getManDist() const {
   return m_manDist;
 }
 
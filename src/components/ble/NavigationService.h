@@ -17,8 +17,9 @@
 */
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <string>
+#include "utility/VersionedString.h"
 #define min // workaround: nimble's min/max macros conflict with libstdc++
 #define max
 #include <host/ble_gap.h>
@@ -37,11 +38,20 @@ namespace Pinetime {
 
       int OnCommand(struct ble_gatt_access_ctxt* ctxt);
 
-      std::string getFlag();
+      // The flag is the name of an icon, the longest one has 25 characters
+      static constexpr size_t maxFlagSize = 32;
+      static constexpr size_t maxNarrativeSize = 100;
+      static constexpr size_t maxManDistSize = 16;
+      using Flag = Utility::VersionedString<maxFlagSize>;
+      using Narrative = Utility::VersionedString<maxNarrativeSize>;
+      using ManDist = Utility::VersionedString<maxManDistSize>;
 
-      std::string getNarrative();
+      // The texts are updated in place: compare their Version() to know when they change
+      const Flag& getFlag() const;
 
-      std::string getManDist();
+      const Narrative& getNarrative() const;
+
+      const ManDist& getManDist() const;
 
       int getProgress();
 
@@ -49,9 +59,9 @@ namespace Pinetime {
       struct ble_gatt_chr_def characteristicDefinition[5];
       struct ble_gatt_svc_def serviceDefinition[2];
 
-      std::string m_flag;
-      std::string m_narrative;
-      std::string m_manDist;
+      Flag m_flag;
+      Narrative m_narrative;
+      ManDist m_manDist;
       int m_progress;
     };
   }
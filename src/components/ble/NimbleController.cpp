@@ -30,7 +30,8 @@ NimbleController::NimbleController(Pinetime::System::SystemTask& systemTask,
                                    Pinetime::Drivers::SpiNorFlash& spiNorFlash,
                                    HeartRateController& heartRateController,
                                    MotionController& motionController,
-                                   FS& fs)
+                                   FS& fs,
+                                   ChangeNotifier& changeNotifier)
   : systemTask {systemTask},
     bleController {bleController},
     dateTimeController {dateTimeController},
@@ -43,7 +44,7 @@ NimbleController::NimbleController(Pinetime::System::SystemTask& systemTask,
     alertNotificationClient {systemTask, notificationManager},
     currentTimeService {dateTimeController},
     musicService {*this},
-    weatherService {dateTimeController},
+    weatherService {dateTimeController, changeNotifier},
     batteryInformationService {batteryController},
     immediateAlertService {systemTask, notificationManager},
     heartRateService {*this, heartRateController},
@@ -67,6 +68,11 @@ void nimble_on_sync(void) {
   nptr->StartAdvertising();
 }
 
+void ConnectionIdleTimerCallback(TimerHandle_t xTimer) {
+  auto* nimbleController = static_cast<NimbleController*>(pvTimerGetTimerID(xTimer));
+  nimbleController->OnIdleTimeout();
+}
+
 int GAPEventCallback(struct ble_gap_event* event, void* arg) {
   auto nimbleController = static_cast<NimbleController*>(arg);
   return nimbleController->OnGAPEvent(event);
@@ -78,6 +84,7 @@ void NimbleController::Init() {
   }
 
   nptr = this;
+  idleTimer = xTimerCreate("bleIdle", idleDelay, pdFALSE, this, ConnectionIdleTimerCallback);
   ble_hs_cfg.reset_cb = nimble_on_reset;
   ble_hs_cfg.sync_cb = nimble_on_sync;
   ble_hs_cfg.store_status_cb = ble_store_util_status_rr;
@@ -203,6 +210,9 @@ int NimbleController::OnGAPEvent(ble_gap_event* event) {
         StartAdvertising();
       } else {
         connectionHandle = event->connect.conn_handle;
+        connectionProfile = ConnectionProfile::Unknown;
+        // Let the central use its own parameters for the service discovery, then switch to the idle profile
+        xTimerStart(idleTimer, 0);
         bleController.Connect();
         systemTask.PushMessage(Pinetime::System::Messages::BleConnected);
         // Service discovery is deferred via systemtask
@@ -220,6 +230,8 @@ int NimbleController::OnGAPEvent(ble_gap_event* event) {
 
       currentTimeClient.Reset();
       alertNotificationClient.Reset();
+      fsService.Reset();
+      xTimerStop(idleTimer, 0);
       connectionHandle = BLE_HS_CONN_HANDLE_NONE;
       if (bleController.IsConnected()) {
         bleController.Disconnect();
@@ -232,6 +244,10 @@ int NimbleController::OnGAPEvent(ble_gap_event* event) {
       /* The central has updated the connection parameters. */
       NRF_LOG_INFO("Update event : BLE_GAP_EVENT_CONN_UPDATE");
       NRF_LOG_INFO("update status=%0X ", event->conn_update.status);
+      if (event->conn_update.status != 0) {
+        // The request was rejected, allow the next one to try again
+        connectionProfile = ConnectionProfile::Unknown;
+      }
       break;
 
     case BLE_GAP_EVENT_CONN_UPDATE_REQ:
@@ -400,6 +416,33 @@ void NimbleController::NotifyBatteryLevel(uint8_t level) {
   }
 }
 
+void NimbleController::StartBulkTransfer() {
+  xTimerReset(idleTimer, 0);
+  SetConnectionProfile(ConnectionProfile::BulkTransfer);
+}
+
+void NimbleController::OnIdleTimeout() {
+  // The DFU service doesn't report its activity, keep the short interval until the update ends
+  if (bleController.IsFirmwareUpdating()) {
+    xTimerStart(idleTimer, 0);
+    return;
+  }
+  SetConnectionProfile(ConnectionProfile::Idle);
+}
+
+void NimbleController::SetConnectionProfile(ConnectionProfile profile) {
+  if (profile == connectionProfile || connectionHandle == BLE_HS_CONN_HANDLE_NONE) {
+    return;
+  }
+
+  const ble_gap_upd_params& params = (profile == ConnectionProfile::BulkTransfer) ? bulkTransferParameters : idleParameters;
+  int rc = ble_gap_update_params(connectionHandle, &params);
+  NRF_LOG_INFO("Connection parameters update request : profile=%d rc=%d", profile, rc);
+  if (rc == 0) {
+    connectionProfile = profile;
+  }
+}
+
 void NimbleController::EnableRadio() {
   bleController.EnableRadio();
   bleController.Disconnect();
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <FreeRTOS.h>
+#include <timers.h>
 #define min // workaround: nimble's min/max macros conflict with libstdc++
 #define max
 #include <host/ble_gap.h>
@@ -49,7 +51,8 @@ namespace Pinetime {
                        Pinetime::Drivers::SpiNorFlash& spiNorFlash,
                        HeartRateController& heartRateController,
                        MotionController& motionController,
-                       FS& fs);
+                       FS& fs,
+                       ChangeNotifier& changeNotifier);
       void Init();
       void StartAdvertising();
       int OnGAPEvent(ble_gap_event* event);
@@ -71,6 +74,10 @@ namespace Pinetime {
         return weatherService;
       };
 
+      Pinetime::Controllers::DfuService& dfu() {
+        return dfuService;
+      };
+
       uint16_t connHandle();
       void NotifyBatteryLevel(uint8_t level);
 
@@ -81,7 +88,36 @@ namespace Pinetime {
       void EnableRadio();
       void DisableRadio();
 
+      // Asks the central for a short connection interval while a firmware update or a file transfer runs.
+      // The idle parameters are requested again once no transfer was started for idleDelay.
+      void StartBulkTransfer();
+      void OnIdleTimeout();
+
     private:
+      enum class ConnectionProfile : uint8_t { Unknown, Idle, BulkTransfer };
+
+      // Intervals are in units of 1.25ms, supervision timeouts in units of 10ms.
+      // Both profiles follow the constraints of Apple's accessory design guidelines, among which
+      // itvl_max * (latency + 1) * 3 < supervision_timeout, so that 3 connection events can be missed.
+      static constexpr ble_gap_upd_params bulkTransferParameters {.itvl_min = 12,
+                                                                  .itvl_max = 24,
+                                                                  .latency = 0,
+                                                                  .supervision_timeout = 400,
+                                                                  .min_ce_len = 0,
+                                                                  .max_ce_len = 0};
+      static constexpr ble_gap_upd_params idleParameters {.itvl_min = 240,
+                                                          .itvl_max = 312,
+                                                          .latency = 4,
+                                                          .supervision_timeout = 600,
+                                                          .min_ce_len = 0,
+                                                          .max_ce_len = 0};
+      static_assert(bulkTransferParameters.itvl_max * 125 * (bulkTransferParameters.latency + 1) * 3 <
+                    bulkTransferParameters.supervision_timeout * 1000);
+      static_assert(idleParameters.itvl_max * 125 * (idleParameters.latency + 1) * 3 < idleParameters.supervision_timeout * 1000);
+      static constexpr TickType_t idleDelay = pdMS_TO_TICKS(10000);
+
+      void SetConnectionProfile(ConnectionProfile profile);
+
       void PersistBond(struct ble_gap_conn_desc& desc);
       void RestoreBond();
 
@@ -112,6 +148,8 @@ namespace Pinetime {
       uint16_t connectionHandle = BLE_HS_CONN_HANDLE_NONE;
       uint8_t fastAdvCount = 0;
       uint8_t bondId[16] = {0};
+      TimerHandle_t idleTimer;
+      ConnectionProfile connectionProfile = ConnectionProfile::Unknown;
 
       ble_uuid128_t dfuServiceUuid {
         .u {.type = BLE_UUID_TYPE_128},
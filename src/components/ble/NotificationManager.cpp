@@ -11,6 +11,7 @@ void NotificationManager::Push(NotificationManager::Notification&& notif) {
   notif.id = GetNextId();
   notif.valid = true;
   newNotification = true;
+  changeNotifier.Publish(ChangeNotifier::Topic::Notifications);
   if (beginIdx > 0) {
     --beginIdx;
   } else {
@@ -125,7 +126,11 @@ bool NotificationManager::AreNewNotificationsAvailable() const {
 }
 
 bool NotificationManager::ClearNewNotificationFlag() {
-  return newNotification.exchange(false);
+  bool wasNew = newNotification.exchange(false);
+  if (wasNew) {
+    changeNotifier.Publish(ChangeNotifier::Topic::Notifications);
+  }
+  return wasNew;
 }
 
 size_t NotificationManager::NbNotifications() const {
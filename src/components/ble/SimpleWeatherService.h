@@ -32,6 +32,7 @@
 #undef min
 
 #include "components/datetime/DateTimeController.h"
+#include "components/events/ChangeNotifier.h"
 
 int WeatherCallback(uint16_t connHandle, uint16_t attrHandle, struct ble_gatt_access_ctxt* ctxt, void* arg);
 
@@ -40,7 +41,7 @@ namespace Pinetime {
 
     class SimpleWeatherService {
     public:
-      explicit SimpleWeatherService(const DateTime& dateTimeController);
+      SimpleWeatherService(const DateTime& dateTimeController, ChangeNotifier& changeNotifier);
 
       void Init();
 
@@ -137,6 +138,7 @@ namespace Pinetime {
       uint16_t eventHandle {};
 
       const Pinetime::Controllers::DateTime& dateTimeController;
+      ChangeNotifier& changeNotifier;
 
       std::optional<CurrentWeather> currentWeather;
       std::optional<Forecast> forecast;
@@ -11,7 +11,8 @@ namespace {
   char const* MonthsStringLow[] = {"--", "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
 }
 
-DateTime::DateTime(Controllers::Settings& settingsController) : settingsController {settingsController} {
+DateTime::DateTime(Controllers::Settings& settingsController, ChangeNotifier& changeNotifier)
+  : settingsController {settingsController}, changeNotifier {changeNotifier} {
 }
 
 void DateTime::SetCurrentTime(std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> t) {
@@ -72,6 +73,17 @@ void DateTime::UpdateTime(uint32_t systickCounter) {
   std::time_t currentTime = std::chrono::system_clock::to_time_t(currentDateTime);
   localTime = *std::localtime(&currentTime);
 
+  const auto second = std::chrono::time_point_cast<std::chrono::seconds>(currentDateTime);
+  if (second != publishedSecond) {
+    publishedSecond = second;
+    changeNotifier.Publish(ChangeNotifier::Topic::Second);
+  }
+  const auto currentMinute = std::chrono::time_point_cast<std::chrono::minutes>(currentDateTime);
+  if (currentMinute != publishedMinute) {
+    publishedMinute = currentMinute;
+    changeNotifier.Publish(ChangeNotifier::Topic::Minute);
+  }
+
   auto minute = Minutes();
   auto hour = Hours();
 
@@ -5,6 +5,7 @@
 #include <ctime>
 #include <string>
 #include "components/settings/Settings.h"
+#include "components/events/ChangeNotifier.h"
 
 namespace Pinetime {
   namespace System {
@@ -14,7 +15,7 @@ namespace Pinetime {
   namespace Controllers {
     class DateTime {
     public:
-      DateTime(Controllers::Settings& settingsController);
+      DateTime(Controllers::Settings& settingsController, ChangeNotifier& changeNotifier);
       enum class Days : uint8_t { Unknown, Monday, Tuesday, Wednesday, Thursday, Friday, Saturday, Sunday };
       enum class Months : uint8_t {
         Unknown,
@@ -148,12 +149,15 @@ namespace Pinetime {
       uint32_t previousSystickCounter = 0;
       std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> currentDateTime;
       std::chrono::seconds uptime {0};
+      std::chrono::time_point<std::chrono::system_clock, std::chrono::seconds> publishedSecond {};
+      std::chrono::time_point<std::chrono::system_clock, std::chrono::minutes> publishedMinute {};
 
       bool isMidnightAlreadyNotified = false;
       bool isHourAlreadyNotified = true;
       bool isHalfHourAlreadyNotified = true;
       System::SystemTask* systemTask = nullptr;
       Controllers::Settings& settingsController;
+      ChangeNotifier& changeNotifier;
     };
   }
 }
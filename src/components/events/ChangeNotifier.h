@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace Pinetime {
+  namespace Controllers {
+    // Lets the controllers tell the display which of their values changed, so that screens are refreshed
+    // when something they show changes instead of polling the controllers periodically.
+    // Publish() can be called from any task or interrupt. The changes are accumulated until the subscriber
+    // takes them, and the subscriber is woken up only once per batch, for the topics it subscribed to.
+    class ChangeNotifier {
+    public:
+      enum class Topic : uint8_t { Second, Minute, Battery, Ble, Notifications, HeartRate, Steps, Weather };
+      using Topics = uint32_t;
+      using WakeUpCallback = void (*)(void* context);
+
+      template <typename... T>
+      static constexpr Topics Mask(T... topics) {
+        return ((Topics {1} << static_cast<uint8_t>(topics)) | ... | 0);
+      }
+
+      void SetWakeUpCallback(WakeUpCallback callback, void* context) {
+        wakeUpContext = context;
+        wakeUpCallback = callback;
+      }
+
+      void Subscribe(Topics topics) {
+        subscribed = topics;
+      }
+
+      void Publish(Topic topic) {
+        const Topics mask = Mask(topic);
+        const Topics subscribedTopics = subscribed;
+        const Topics previous = pending.fetch_or(mask);
+        if ((mask & subscribedTopics) != 0 && (previous & subscribedTopics) == 0 && wakeUpCallback != nullptr) {
+          wakeUpCallback(wakeUpContext);
+        }
+      }
+
+      // Returns the subscribed topics published since the previous call
+      Topics Take() {
+        return pending.exchange(0) & subscribed;
+      }
+
+    private:
+      std::atomic<Topics> pending {0};
+      std::atomic<Topics> subscribed {0};
+      WakeUpCallback wakeUpCallback = nullptr;
+      void* wakeUpContext = nullptr;
+    };
+  }
+}
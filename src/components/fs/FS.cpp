@@ -1,4 +1,5 @@
 #include "components/fs/FS.h"
+#include <algorithm>
 #include <cstring>
 #include <littlefs/lfs.h>
 #include <lvgl/lvgl.h>
@@ -20,7 +21,7 @@ FS::FS(Pinetime::Drivers::SpiNorFlash& driver)
       .block_count = size / blockSize,
       .block_cycles = 1000u,
 
-      .cache_size = 16,
+      .cache_size = 64,
       .lookahead_size = 16,
 
       .name_max = 50,
@@ -29,6 +30,7 @@ FS::FS(Pinetime::Drivers::SpiNorFlash& driver)
 }
 
 void FS::Init() {
+  mutex = xSemaphoreCreateMutex();
 
   // try mount
   int err = lfs_mount(&lfs, &lfsConfig);
@@ -54,59 +56,101 @@ void FS::VerifyResource() {
 }
 
 int FS::FileOpen(lfs_file_t* file_p, const char* fileName, const int flags) {
-  return lfs_file_open(&lfs, file_p, fileName, flags);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_file_open(&lfs, file_p, fileName, flags);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::FileClose(lfs_file_t* file_p) {
-  return lfs_file_close(&lfs, file_p);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_file_close(&lfs, file_p);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::FileRead(lfs_file_t* file_p, uint8_t* buff, uint32_t size) {
-  return lfs_file_read(&lfs, file_p, buff, size);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_file_read(&lfs, file_p, buff, size);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::FileWrite(lfs_file_t* file_p, const uint8_t* buff, uint32_t size) {
-  return lfs_file_write(&lfs, file_p, buff, size);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_file_write(&lfs, file_p, buff, size);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::FileSeek(lfs_file_t* file_p, uint32_t pos) {
-  return lfs_file_seek(&lfs, file_p, pos, LFS_SEEK_SET);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_file_seek(&lfs, file_p, pos, LFS_SEEK_SET);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::FileDelete(const char* fileName) {
-  return lfs_remove(&lfs, fileName);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_remove(&lfs, fileName);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::DirOpen(const char* path, lfs_dir_t* lfs_dir) {
-  return lfs_dir_open(&lfs, lfs_dir, path);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_dir_open(&lfs, lfs_dir, path);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::DirClose(lfs_dir_t* lfs_dir) {
-  return lfs_dir_close(&lfs, lfs_dir);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_dir_close(&lfs, lfs_dir);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::DirRead(lfs_dir_t* dir, lfs_info* info) {
-  return lfs_dir_read(&lfs, dir, info);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_dir_read(&lfs, dir, info);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::DirRewind(lfs_dir_t* dir) {
-  return lfs_dir_rewind(&lfs, dir);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_dir_rewind(&lfs, dir);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::DirCreate(const char* path) {
-  return lfs_mkdir(&lfs, path);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_mkdir(&lfs, path);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::Rename(const char* oldPath, const char* newPath) {
-  return lfs_rename(&lfs, oldPath, newPath);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_rename(&lfs, oldPath, newPath);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 int FS::Stat(const char* path, lfs_info* info) {
-  return lfs_stat(&lfs, path, info);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const int result = lfs_stat(&lfs, path, info);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 lfs_ssize_t FS::GetFSSize() {
-  return lfs_fs_size(&lfs);
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  const lfs_ssize_t result = lfs_fs_size(&lfs);
+  xSemaphoreGive(mutex);
+  return result;
 }
 
 /*
@@ -121,6 +165,7 @@ int FS::SectorSync(const struct lfs_config* /*c*/) {
 int FS::SectorErase(const struct lfs_config* c, lfs_block_t block) {
   Pinetime::Controllers::FS& lfs = *(static_cast<Pinetime::Controllers::FS*>(c->context));
   const size_t address = startAddress + (block * blockSize);
+  lfs.InvalidateReadAhead(address, blockSize);
   lfs.flashDriver.SectorErase(address);
   return lfs.flashDriver.EraseFailed() ? -1 : 0;
 }
@@ -128,6 +173,7 @@ int FS::SectorErase(const struct lfs_config* c, lfs_block_t block) {
 int FS::SectorProg(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, const void* buffer, lfs_size_t size) {
   Pinetime::Controllers::FS& lfs = *(static_cast<Pinetime::Controllers::FS*>(c->context));
   const size_t address = startAddress + (block * blockSize) + off;
+  lfs.InvalidateReadAhead(address, size);
   lfs.flashDriver.Write(address, (uint8_t*) buffer, size);
   return lfs.flashDriver.ProgramFailed() ? -1 : 0;
 }
@@ -135,6 +181,35 @@ int FS::SectorProg(const struct lfs_config* c, lfs_block_t block, lfs_off_t off,
 int FS::SectorRead(const struct lfs_config* c, lfs_block_t block, lfs_off_t off, void* buffer, lfs_size_t size) {
   Pinetime::Controllers::FS& lfs = *(static_cast<Pinetime::Controllers::FS*>(c->context));
   const size_t address = startAddress + (block * blockSize) + off;
-  lfs.flashDriver.Read(address, static_cast<uint8_t*>(buffer), size);
+  lfs.Read(address, static_cast<uint8_t*>(buffer), size);
   return 0;
 }
+
+void FS::Read(size_t address, uint8_t* buffer, size_t size) {
+  if (size >= readAheadSize) {
+    flashDriver.Read(address, buffer, size);
+    return;
+  }
+
+  while (size > 0) {
+    const size_t window = address - (address % readAheadSize);
+    if (!readAheadValid || window != readAheadAddress) {
+      flashDriver.Read(window, readAheadBuffer.data(), readAheadSize);
+      readAheadAddress = window;
+      readAheadValid = true;
+    }
+
+    const size_t offset = address - window;
+    const size_t length = std::min(size, readAheadSize - offset);
+    std::memcpy(buffer, &readAheadBuffer[offset], length);
+    address += length;
+    buffer += length;
+    size -= length;
+  }
+}
+
+void FS::InvalidateReadAhead(size_t address, size_t size) {
+  if (address < readAheadAddress + readAheadSize && readAheadAddress < address + size) {
+    readAheadValid = false;
+  }
+}
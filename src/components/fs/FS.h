@@ -1,11 +1,17 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
+#include <FreeRTOS.h>
+#include <semphr.h>
 #include "drivers/SpiNorFlash.h"
 #include <littlefs/lfs.h>
 
 namespace Pinetime {
   namespace Controllers {
+    // The littlefs calls are serialized by a mutex: the display task reads fonts and images while
+    // SystemTask and the BLE host write the settings, the histories and the transferred files.
+    // A lfs_file_t or lfs_dir_t must still only be used by one task at a time.
     class FS {
     public:
       FS(Pinetime::Drivers::SpiNorFlash&);
@@ -68,10 +74,25 @@ namespace Pinetime {
       static constexpr size_t size = 0x34C000;
       static constexpr size_t blockSize = 4096;
 
+      // littlefs reads files and metadata in cache_size chunks. SectorRead fetches the whole aligned
+      // window of readAheadSize bytes around a small read, so the following sequential reads are served
+      // from RAM instead of each paying for a flash command. A window is read in a single SPI transfer,
+      // so it must stay below the 255 bytes EasyDMA limit. Set to 0 to disable the read-ahead.
+      static constexpr size_t readAheadSize = 128;
+      static_assert(readAheadSize == 0 || blockSize % readAheadSize == 0, "read-ahead windows must not cross blocks");
+
+      std::array<uint8_t, readAheadSize> readAheadBuffer;
+      size_t readAheadAddress = 0;
+      bool readAheadValid = false;
+
+      void Read(size_t address, uint8_t* buffer, size_t size);
+      void InvalidateReadAhead(size_t address, size_t size);
+
       bool resourcesValid = false;
       const struct lfs_config lfsConfig;
 
       lfs_t lfs;
+      SemaphoreHandle_t mutex = nullptr;
 
       static int SectorSync(const struct lfs_config* c);
       static int SectorErase(const struct lfs_config* c, lfs_block_t block);
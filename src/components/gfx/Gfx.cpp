@@ -1,52 +1,97 @@
 #include "components/gfx/Gfx.h"
+#include <nrf_log.h>
 #include "drivers/St7789.h"
+#include "utility/Rgb565.h"
 using namespace Pinetime::Components;
 
 Gfx::Gfx(Pinetime::Drivers::St7789& lcd) : lcd {lcd} {
 }
 
 void Gfx::Init() {
+  commands = xQueueCreate(queueSize, sizeof(Command));
+  if (pdPASS != xTaskCreate(Gfx::Process, "gfx", 200, this, 0, &taskHandle)) {
+    APP_ERROR_HANDLER(NRF_ERROR_NO_MEM);
+  }
 }
 
-void Gfx::ClearScreen() {
-  SetBackgroundColor(0x0000);
-
-  state.remainingIterations = 240 + 1;
-  state.currentIteration = 0;
-  state.busy = true;
-  state.action = Action::FillRectangle;
-  state.taskToNotify = xTaskGetCurrentTaskHandle();
-
-  lcd.DrawBuffer(0, 0, width, height, reinterpret_cast<const uint8_t*>(buffer), width * 2);
-  WaitTransferFinished();
+void Gfx::Process(void* instance) {
+  auto* gfx = static_cast<Gfx*>(instance);
+  while (true) {
+    if (xQueueReceive(gfx->commands, &gfx->current, portMAX_DELAY) == pdTRUE) {
+      gfx->Draw();
+    }
+  }
 }
 
-void Gfx::FillRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color) {
-  SetBackgroundColor(color);
+void Gfx::Push(const Command& command) {
+  xQueueSend(commands, &command, portMAX_DELAY);
+}
+
+void Gfx::Draw() {
+  switch (current.action) {
+    case Action::FillRectangle:
+      SetBackgroundColor(current.color);
+      break;
+    case Action::SetScrollArea:
+      lcd.VerticalScrollDefinition(current.scroll[0], current.scroll[1], current.scroll[2]);
+      return;
+    case Action::SetScrollStartLine:
+      lcd.VerticalScrollStartAddress(current.scroll[0]);
+      return;
+    case Action::Sync:
+      xTaskNotifyGive(current.taskToNotify);
+      return;
+    default:
+      break;
+  }
 
-  state.remainingIterations = h;
-  state.currentIteration = 0;
-  state.busy = true;
-  state.action = Action::FillRectangle;
-  state.color = color;
-  state.taskToNotify = xTaskGetCurrentTaskHandle();
+  // The whole rectangle is drawn in a single window. Generated lines are sent one at a time: the next
+  // one is generated in the buffer that was just sent.
+  currentLine = 0;
+  uint8_t* data;
+  size_t size;
+  bool first = true;
+  while (GetNextBuffer(&data, size)) {
+    if (first) {
+      lcd.DrawBuffer(current.x, current.y, current.w, current.h, data, size);
+      first = false;
+    } else {
+      lcd.ContinueDrawBuffer(data, size);
+    }
+    WaitTransferFinished();
+  }
+}
 
-  lcd.DrawBuffer(x, y, w, h, reinterpret_cast<const uint8_t*>(buffer), width * 2);
+void Gfx::ClearScreen() {
+  FillRectangle(0, 0, width, height, 0x0000);
+}
 
-  WaitTransferFinished();
+void Gfx::FillRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t color) {
+  if (w == 0 || h == 0) {
+    return;
+  }
+  Command command;
+  command.action = Action::FillRectangle;
+  command.x = x;
+  command.y = y;
+  command.w = w;
+  command.h = h;
+  command.color = color;
+  Push(command);
 }
 
 void Gfx::FillRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t* b) {
-  state.remainingIterations = h;
-  state.currentIteration = 0;
-  state.busy = true;
-  state.action = Action::FillRectangle;
-  state.color = 0x00;
-  state.taskToNotify = xTaskGetCurrentTaskHandle();
-
-  lcd.DrawBuffer(x, y, w, h, reinterpret_cast<const uint8_t*>(b), width * 2);
-
-  WaitTransferFinished();
+  if (w == 0 || h == 0) {
+    return;
+  }
+  Command command;
+  command.action = Action::FillRectangleWithBuffer;
+  command.x = x;
+  command.y = y;
+  command.w = w;
+  command.h = h;
+  command.data = b;
+  Push(command);
 }
 
 void Gfx::DrawString(uint8_t x, uint8_t y, uint16_t color, const char* text, const FONT_INFO* p_font, bool wrap) {
@@ -87,44 +132,32 @@ void Gfx::DrawString(uint8_t x, uint8_t y, uint16_t color, const char* text, con
 void Gfx::DrawChar(const FONT_INFO* font, uint8_t c, uint8_t* x, uint8_t y, uint16_t color) {
   uint8_t char_idx = c - font->startChar;
   uint16_t bytes_in_line = CEIL_DIV(font->charInfo[char_idx].widthBits, 8);
-  uint16_t bg = 0x0000;
 
   if (c == ' ') {
     *x += font->height / 2;
     return;
   }
 
-  // Build first line
-  for (uint16_t j = 0; j < bytes_in_line; j++) {
-    for (uint8_t k = 0; k < 8; k++) {
-      if ((1 << (7 - k)) & font->data[font->charInfo[char_idx].offset + j]) {
-        buffer[(j * 8) + k] = color;
-      } else {
-        buffer[(j * 8) + k] = bg;
-      }
-    }
-  }
-
-  state.remainingIterations = font->height + 0;
-  state.currentIteration = 0;
-  state.busy = true;
-  state.action = Action::DrawChar;
-  state.font = const_cast<FONT_INFO*>(font);
-  state.character = c;
-  state.color = color;
-  state.taskToNotify = xTaskGetCurrentTaskHandle();
-
-  lcd.DrawBuffer(*x, y, bytes_in_line * 8, font->height, reinterpret_cast<const uint8_t*>(&buffer), bytes_in_line * 8 * 2);
-  WaitTransferFinished();
+  Command command;
+  command.action = Action::DrawChar;
+  command.x = *x;
+  command.y = y;
+  command.w = bytes_in_line * 8;
+  command.h = font->height;
+  command.font = font;
+  command.character = c;
+  command.color = color;
+  Push(command);
 
   *x += font->charInfo[char_idx].widthBits + font->spacePixels;
 }
 
 void Gfx::pixel_draw(uint8_t x, uint8_t y, uint16_t color) {
-  lcd.DrawPixel(x, y, color);
+  FillRectangle(x, y, 1, 1, color);
 }
 
 void Gfx::Sleep() {
+  WaitIdle();
   lcd.Sleep();
 }
 
@@ -132,34 +165,42 @@ void Gfx::Wakeup() {
   lcd.Wakeup();
 }
 
+void Gfx::WaitIdle() {
+  Command command;
+  command.action = Action::Sync;
+  command.taskToNotify = xTaskGetCurrentTaskHandle();
+  Push(command);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
 void Gfx::SetBackgroundColor(uint16_t color) {
-  for (int i = 0; i < width; i++) {
-    buffer[i] = color;
-  }
+  Utility::Rgb565::Fill(buffer, width, color);
 }
 
 bool Gfx::GetNextBuffer(uint8_t** data, size_t& size) {
-  if (!state.busy)
-    return false;
-  state.remainingIterations = state.remainingIterations - 1;
-  if (state.remainingIterations == 0) {
-    state.busy = false;
-    NotifyEndOfTransfer(state.taskToNotify);
+  if (currentLine >= current.h) {
     return false;
   }
 
-  if (state.action == Action::FillRectangle) {
+  if (current.action == Action::FillRectangle) {
     *data = reinterpret_cast<uint8_t*>(buffer);
-    size = width * 2;
-  } else if (state.action == Action::DrawChar) {
-    uint16_t bg = 0x0000;
-    uint8_t char_idx = state.character - state.font->startChar;
-    uint16_t bytes_in_line = CEIL_DIV(state.font->charInfo[char_idx].widthBits, 8);
+    size = current.w * 2;
+  } else if (current.action == Action::FillRectangleWithBuffer) {
+    // The buffer holds the whole rectangle: send it at once
+    *data = const_cast<uint8_t*>(current.data);
+    size = current.w * current.h * 2;
+    currentLine = current.h;
+    return true;
+  } else if (current.action == Action::DrawChar) {
+    const uint16_t fg = Utility::Rgb565::ToDisplayOrder(current.color);
+    const uint16_t bg = 0x0000;
+    uint8_t char_idx = current.character - current.font->startChar;
+    uint16_t bytes_in_line = CEIL_DIV(current.font->charInfo[char_idx].widthBits, 8);
 
     for (uint16_t j = 0; j < bytes_in_line; j++) {
       for (uint8_t k = 0; k < 8; k++) {
-        if ((1 << (7 - k)) & state.font->data[state.font->charInfo[char_idx].offset + ((state.currentIteration + 1) * bytes_in_line) + j]) {
-          buffer[(j * 8) + k] = state.color;
+        if ((1 << (7 - k)) & current.font->data[current.font->charInfo[char_idx].offset + (currentLine * bytes_in_line) + j]) {
+          buffer[(j * 8) + k] = fg;
         } else {
           buffer[(j * 8) + k] = bg;
         }
@@ -168,29 +209,30 @@ bool Gfx::GetNextBuffer(uint8_t** data, size_t& size) {
 
     *data = reinterpret_cast<uint8_t*>(buffer);
     size = bytes_in_line * 8 * 2;
+  } else {
+    return false;
   }
 
-  state.currentIteration = state.currentIteration + 1;
-
+  currentLine++;
   return true;
 }
 
-void Gfx::NotifyEndOfTransfer(TaskHandle_t task) {
-  if (task != nullptr) {
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    vTaskNotifyGiveFromISR(task, &xHigherPriorityTaskWoken);
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
-  }
-}
-
 void Gfx::WaitTransferFinished() const {
   ulTaskNotifyTake(pdTRUE, 500);
 }
 
 void Gfx::SetScrollArea(uint16_t topFixedLines, uint16_t scrollLines, uint16_t bottomFixedLines) {
-  lcd.VerticalScrollDefinition(topFixedLines, scrollLines, bottomFixedLines);
+  Command command;
+  command.action = Action::SetScrollArea;
+  command.scroll[0] = topFixedLines;
+  command.scroll[1] = scrollLines;
+  command.scroll[2] = bottomFixedLines;
+  Push(command);
 }
 
 void Gfx::SetScrollStartLine(uint16_t line) {
-  lcd.VerticalScrollStartAddress(line);
+  Command command;
+  command.action = Action::SetScrollStartLine;
+  command.scroll[0] = line;
+  Push(command);
 }
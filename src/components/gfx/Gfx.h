@@ -1,6 +1,7 @@
 #pragma once
 #include <FreeRTOS.h>
 #include <nrf_font.h>
+#include <queue.h>
 #include <task.h>
 #include <cstddef>
 #include <cstdint>
@@ -12,6 +13,9 @@ namespace Pinetime {
   }
 
   namespace Components {
+    // Colors are RGB565 values in native byte order, they are converted to the byte order of the display when drawn.
+    // Drawing primitives are queued and drawn by the gfx task: they return as soon as the command is queued
+    // and only block when the queue is full. Call WaitIdle() to wait until everything is on screen.
     class Gfx : public Pinetime::Drivers::BufferProvider {
     public:
       explicit Gfx(Drivers::St7789& lcd);
@@ -20,9 +24,11 @@ namespace Pinetime {
       void DrawString(uint8_t x, uint8_t y, uint16_t color, const char* text, const FONT_INFO* p_font, bool wrap);
       void DrawChar(const FONT_INFO* font, uint8_t c, uint8_t* x, uint8_t y, uint16_t color);
       void FillRectangle(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint16_t color);
+      // b contains w * h pixels in display byte order and must stay valid until WaitIdle() returns
       void FillRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t* b);
       void SetScrollArea(uint16_t topFixedLines, uint16_t scrollLines, uint16_t bottomFixedLines);
       void SetScrollStartLine(uint16_t line);
+      void WaitIdle();
 
       void Sleep();
       void Wakeup();
@@ -32,31 +38,37 @@ namespace Pinetime {
     private:
       static constexpr uint8_t width = 240;
       static constexpr uint8_t height = 240;
+      static constexpr uint8_t queueSize = 8;
 
-      enum class Action { None, FillRectangle, DrawChar };
+      enum class Action : uint8_t { None, FillRectangle, FillRectangleWithBuffer, DrawChar, SetScrollArea, SetScrollStartLine, Sync };
 
-      struct State {
-        State() : busy {false}, action {Action::None}, remainingIterations {0}, currentIteration {0} {
-        }
-
-        volatile bool busy;
-        volatile Action action;
-        volatile uint16_t remainingIterations;
-        volatile uint16_t currentIteration;
-        volatile FONT_INFO* font;
-        volatile uint16_t color;
-        volatile uint8_t character;
-        volatile TaskHandle_t taskToNotify = nullptr;
+      struct Command {
+        Action action = Action::None;
+        uint8_t x = 0;
+        uint8_t y = 0;
+        uint8_t w = 0;
+        uint8_t h = 0;
+        uint8_t character = 0;
+        uint16_t color = 0;
+        uint16_t scroll[3] = {};
+        const FONT_INFO* font = nullptr;
+        const uint8_t* data = nullptr;
+        TaskHandle_t taskToNotify = nullptr;
       };
 
-      volatile State state;
+      Command current;
+      uint16_t currentLine = 0;
 
       uint16_t buffer[width]; // 1 line buffer
       Drivers::St7789& lcd;
+      QueueHandle_t commands = nullptr;
+      TaskHandle_t taskHandle = nullptr;
 
+      static void Process(void* instance);
+      void Push(const Command& command);
+      void Draw();
       void SetBackgroundColor(uint16_t color);
       void WaitTransferFinished() const;
-      void NotifyEndOfTransfer(TaskHandle_t task);
     };
   }
 }
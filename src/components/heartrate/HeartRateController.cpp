@@ -5,16 +5,22 @@
 using namespace Pinetime::Controllers;
 
 void HeartRateController::Update(HeartRateController::States newState, uint8_t heartRate) {
+  bool changed = (this->state != newState);
   this->state = newState;
   if (this->heartRate != heartRate) {
     this->heartRate = heartRate;
     service->OnNewHeartRateValue(heartRate);
+    changed = true;
+  }
+  if (changed) {
+    changeNotifier.Publish(ChangeNotifier::Topic::HeartRate);
   }
 }
 
 void HeartRateController::Start() {
   if (task != nullptr) {
     state = States::NotEnoughData;
+    changeNotifier.Publish(ChangeNotifier::Topic::HeartRate);
     task->PushMessage(Pinetime::Applications::HeartRateTask::Messages::StartMeasurement);
   }
 }
@@ -22,6 +28,7 @@ void HeartRateController::Start() {
 void HeartRateController::Stop() {
   if (task != nullptr) {
     state = States::Stopped;
+    changeNotifier.Publish(ChangeNotifier::Topic::HeartRate);
     task->PushMessage(Pinetime::Applications::HeartRateTask::Messages::StopMeasurement);
   }
 }
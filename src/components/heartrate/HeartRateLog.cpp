@@ -0,0 +1,197 @@
+#include "components/heartrate/HeartRateLog.h"
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include "components/datetime/DateTimeController.h"
+#include "components/fs/FS.h"
+
+using namespace Pinetime::Controllers;
+
+namespace {
+  constexpr const char* currentPath = "/hrlog.dat";
+  constexpr const char* previousPath = "/hrlog.old";
+  constexpr uint8_t absoluteMarker = 0;
+  constexpr size_t absoluteRecordSize = 6;
+  constexpr size_t deltaRecordSize = 2;
+
+  struct Cursor {
+    uint32_t minutes = 0;
+    uint8_t heartRate = 0;
+  };
+
+  // Decodes the complete records at the beginning of data and returns the number of bytes consumed
+  template <typename F>
+  size_t Decode(const uint8_t* data, size_t size, Cursor& cursor, F& onEntry) {
+    size_t offset = 0;
+    while (offset < size) {
+      if (data[offset] == absoluteMarker) {
+        if (size - offset < absoluteRecordSize) {
+          break;
+        }
+        cursor.minutes = static_cast<uint32_t>(data[offset + 1]) | (static_cast<uint32_t>(data[offset + 2]) << 8) |
+                         (static_cast<uint32_t>(data[offset + 3]) << 16) | (static_cast<uint32_t>(data[offset + 4]) << 24);
+        cursor.heartRate = data[offset + 5];
+        offset += absoluteRecordSize;
+      } else {
+        if (size - offset < deltaRecordSize) {
+          break;
+        }
+        cursor.minutes += data[offset];
+        cursor.heartRate = static_cast<uint8_t>(cursor.heartRate + static_cast<int8_t>(data[offset + 1]));
+        offset += deltaRecordSize;
+      }
+      onEntry(cursor);
+    }
+    return offset;
+  }
+
+  template <typename F>
+  void DecodeFile(FS& fs, const char* path, Cursor& cursor, F& onEntry) {
+    lfs_file_t file;
+    if (fs.FileOpen(&file, path, LFS_O_RDONLY) != LFS_ERR_OK) {
+      return;
+    }
+
+    // Records may straddle two reads: the bytes left over are moved to the beginning of the buffer
+    std::array<uint8_t, 32> buffer;
+    size_t used = 0;
+    while (true) {
+      int read = fs.FileRead(&file, buffer.data() + used, buffer.size() - used);
+      if (read <= 0) {
+        break;
+      }
+      used += read;
+      size_t consumed = Decode(buffer.data(), used, cursor, onEntry);
+      std::memmove(buffer.data(), buffer.data() + consumed, used - consumed);
+      used -= consumed;
+    }
+    fs.FileClose(&file);
+  }
+}
+
+HeartRateLog::HeartRateLog(FS& fs, DateTime& dateTimeController) : fs {fs}, dateTimeController {dateTimeController} {
+}
+
+void HeartRateLog::Init() {
+  mutex = xSemaphoreCreateMutex();
+
+  lfs_info info;
+  if (fs.Stat(currentPath, &info) != LFS_ERR_OK) {
+    return;
+  }
+  fileSize = info.size;
+
+  Cursor cursor;
+  auto onEntry = [this](const Cursor&) {
+    hasLastRecord = true;
+  };
+  DecodeFile(fs, currentPath, cursor, onEntry);
+  lastMinutes = cursor.minutes;
+  lastHeartRate = cursor.heartRate;
+}
+
+void HeartRateLog::Append(uint8_t heartRate) {
+  const auto minutes =
+    static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::minutes>(dateTimeController.UTCDateTime().time_since_epoch()).count());
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  // The buffer is much smaller than a file, so the file is rotated at most once per flush
+  if (!rotationPending && fileSize + pendingSize + absoluteRecordSize > maxFileSize) {
+    rotationPending = true;
+    rotationOffset = pendingSize;
+    // The first record of the new file must be absolute
+    hasLastRecord = false;
+  }
+
+  const int delta = heartRate - lastHeartRate;
+  const bool isAbsolute =
+    !hasLastRecord || minutes <= lastMinutes || minutes - lastMinutes > UINT8_MAX || delta < INT8_MIN || delta > INT8_MAX;
+  if (pendingSize + (isAbsolute ? absoluteRecordSize : deltaRecordSize) > pending.size()) {
+    // The watch slept for too long: drop the record, the next ones stay relative to the last buffered one
+    xSemaphoreGive(mutex);
+    return;
+  }
+
+  uint8_t* record = pending.data() + pendingSize;
+  if (isAbsolute) {
+    record[0] = absoluteMarker;
+    record[1] = static_cast<uint8_t>(minutes);
+    record[2] = static_cast<uint8_t>(minutes >> 8);
+    record[3] = static_cast<uint8_t>(minutes >> 16);
+    record[4] = static_cast<uint8_t>(minutes >> 24);
+    record[5] = heartRate;
+    pendingSize += absoluteRecordSize;
+  } else {
+    record[0] = static_cast<uint8_t>(minutes - lastMinutes);
+    record[1] = static_cast<uint8_t>(static_cast<int8_t>(delta));
+    pendingSize += deltaRecordSize;
+  }
+
+  hasLastRecord = true;
+  lastMinutes = minutes;
+  lastHeartRate = heartRate;
+  xSemaphoreGive(mutex);
+}
+
+void HeartRateLog::Flush() {
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  FlushLocked();
+  xSemaphoreGive(mutex);
+}
+
+size_t HeartRateLog::Read(uint32_t since, Entry* entries, size_t maxEntries) {
+  size_t count = 0;
+  auto onEntry = [&](const Cursor& cursor) {
+    const uint32_t timestamp = cursor.minutes * 60;
+    if (timestamp >= since && count < maxEntries) {
+      entries[count++] = {timestamp, cursor.heartRate};
+    }
+  };
+
+  xSemaphoreTake(mutex, portMAX_DELAY);
+  Cursor cursor;
+  DecodeFile(fs, previousPath, cursor, onEntry);
+  cursor = {};
+  DecodeFile(fs, currentPath, cursor, onEntry);
+  // The pending records follow the last record of the current file
+  Decode(pending.data(), pendingSize, cursor, onEntry);
+  xSemaphoreGive(mutex);
+  return count;
+}
+
+void HeartRateLog::FlushLocked() {
+  if (rotationPending) {
+    Write(pending.data(), rotationOffset);
+    Rotate();
+    Write(pending.data() + rotationOffset, pendingSize - rotationOffset);
+    rotationPending = false;
+  } else {
+    Write(pending.data(), pendingSize);
+  }
+  pendingSize = 0;
+}
+
+void HeartRateLog::Write(const uint8_t* data, size_t size) {
+  if (size == 0) {
+    return;
+  }
+
+  bool written = false;
+  lfs_file_t file;
+  if (fs.FileOpen(&file, currentPath, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) == LFS_ERR_OK) {
+    written = fs.FileWrite(&file, data, size) == static_cast<int>(size);
+    fs.FileClose(&file);
+  }
+
+  if (written) {
+    fileSize += size;
+  } else {
+    // The next record can't be relative to the ones that were lost
+    hasLastRecord = false;
+  }
+}
+
+void HeartRateLog::Rotate() {
+  fs.Rename(currentPath, previousPath);
+  fileSize = 0;
+}
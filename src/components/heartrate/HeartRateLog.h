@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <FreeRTOS.h>
+#include <semphr.h>
+
+namespace Pinetime {
+  namespace Controllers {
+    class FS;
+    class DateTime;
+
+    // Heart rate history, stored in an append-only file on the external flash.
+    // Each file starts with an absolute record: a 0 marker byte, the minutes since the epoch (UTC)
+    // and the BPM. The following records only store the minutes elapsed since the previous record
+    // (1-255) and the BPM difference (signed), 2 bytes each. An absolute record is written again
+    // whenever one of the differences doesn't fit.
+    // Append() only buffers the records in RAM: it is called by the heart rate task, which keeps measuring
+    // while the watch sleeps with the SPI disabled and the flash powered down. SystemTask writes them with
+    // Flush() when the watch is awake. Init() must be called before the heart rate and display tasks start.
+    // The file accesses go through Controllers::FS, whose lock serializes them with the other tasks.
+    // The buffered records are lost on reset, and the new ones are dropped when the buffer is full (after more
+    // than 20 hours of sleep with the shortest measurement interval).
+    // When the current file is full, it replaces the previous one: the history is bounded to 2 files.
+    class HeartRateLog {
+    public:
+      struct Entry {
+        // Seconds since the epoch (UTC), with a resolution of 1 minute
+        uint32_t timestamp;
+        uint8_t heartRate;
+      };
+
+      HeartRateLog(FS& fs, DateTime& dateTimeController);
+
+      void Init();
+      void Append(uint8_t heartRate);
+      // Writes the buffered records to the flash. The SPI and the flash must be awake: don't call it while the system sleeps.
+      void Flush();
+
+      // Copies, oldest first, up to maxEntries entries recorded at or after `since`.
+      // Returns the number of entries copied. Call it again with the timestamp of the last entry + 1 to read the next ones.
+      // Like Flush(), it accesses the flash: don't call it while the system sleeps.
+      size_t Read(uint32_t since, Entry* entries, size_t maxEntries);
+
+      static constexpr uint32_t maxFileSize = 4096;
+
+    private:
+      void FlushLocked();
+      void Write(const uint8_t* data, size_t size);
+      void Rotate();
+
+      FS& fs;
+      DateTime& dateTimeController;
+      SemaphoreHandle_t mutex = nullptr;
+
+      std::array<uint8_t, 256> pending;
+      size_t pendingSize = 0;
+      // The pending records from rotationOffset on go to the next file
+      bool rotationPending = false;
+      size_t rotationOffset = 0;
+      uint32_t fileSize = 0;
+
+      bool hasLastRecord = false;
+      uint32_t lastMinutes = 0;
+      uint8_t lastHeartRate = 0;
+    };
+  }
+}
@@ -1,56 +1,33 @@
 #include "components/heartrate/Ppg.h"
+#include <cmath>
 #include <nrf_log.h>
-#include <vector>
 
 using namespace Pinetime::Controllers;
 
 namespace {
-  float LinearInterpolation(const float* xValues, const float* yValues, int length, float pointX) {
-    if (pointX > xValues[length - 1]) {
-      return yValues[length - 1];
-    } else if (pointX <= xValues[0]) {
-      return yValues[0];
-    }
-    int index = 0;
-    while (pointX > xValues[index] && index < length - 1) {
-      index++;
-    }
-    float pointX0 = xValues[index - 1];
-    float pointX1 = xValues[index];
-    float pointY0 = yValues[index - 1];
-    float pointY1 = yValues[index];
-    float mu = (pointX - pointX0) / (pointX1 - pointX0);
-
-    return (pointY0 * (1 - mu) + pointY1 * mu);
-  }
-
-  float PeakSearch(float* xVals, float* yVals, float threshold, float& width, float start, float end, int length) {
+  // Finds the single peak of the piecewise linear curve through yVals that rises above threshold between start and end.
+  // The threshold crossings are solved on each segment between two bins instead of sampling the curve.
+  // Returns the peak center (bins) and its width at threshold, or 0 if there isn't exactly one peak.
+  float PeakSearch(const float* yVals, float threshold, float& width, int start, int end) {
     int peaks = 0;
-    bool enabled = false;
+    // Only peaks rising from below the threshold after start are considered
+    bool enabled = yVals[start] < threshold;
     float minBin = 0.0f;
-    float maxBin = 0.0f;
     float peakCenter = 0.0f;
-    float prevValue = LinearInterpolation(xVals, yVals, length, start - 0.01f);
-    float currValue = LinearInterpolation(xVals, yVals, length, start);
-    float idx = start;
-    while (idx < end) {
-      float nextValue = LinearInterpolation(xVals, yVals, length, idx + 0.01f);
-      if (currValue < threshold) {
-        enabled = true;
-      }
-      if (currValue >= threshold and enabled) {
-        if (prevValue < threshold) {
-          minBin = idx;
-        } else if (nextValue <= threshold) {
-          maxBin = idx;
+    for (int idx = start; idx < end; idx++) {
+      float y0 = yVals[idx];
+      float y1 = yVals[idx + 1];
+      if (y0 < threshold && y1 >= threshold) {
+        minBin = static_cast<float>(idx) + (threshold - y0) / (y1 - y0);
+      } else if (y0 >= threshold && y1 < threshold) {
+        float maxBin = static_cast<float>(idx) + (y0 - threshold) / (y0 - y1);
+        if (enabled) {
           peaks++;
           width = maxBin - minBin;
           peakCenter = width / 2.0f + minBin;
         }
+        enabled = true;
       }
-      prevValue = currValue;
-      currValue = nextValue;
-      idx += 0.01f;
     }
     if (peaks != 1) {
       width = 0.0f;
@@ -135,15 +112,42 @@ namespace {
     0.15088159f, 0.1882551f,  0.22872687f, 0.27189467f, 0.31732949f, 0.36457977f, 0.41317591f, 0.46263495f,
     0.51246535f, 0.56217185f, 0.61126047f, 0.65924333f, 0.70564355f, 0.75f,       0.79187184f, 0.83084292f,
     0.86652594f, 0.89856625f, 0.92664544f, 0.95048443f, 0.96984631f, 0.98453864f, 0.99441541f, 0.99937846f};
+
+  // sin(2 * pi * i / dataLength) for the first quarter of the period, for the same reason as above.
+  static constexpr float quarterSine[(Ppg::dataLength >> 2) + 1] {
+    0.0f,        0.09801714f, 0.19509032f, 0.29028468f, 0.38268343f, 0.47139674f, 0.55557023f, 0.63439328f, 0.70710678f,
+    0.77301045f, 0.83146961f, 0.88192126f, 0.92387953f, 0.95694034f, 0.98078528f, 0.99518473f, 1.0f};
+
+  float Sine(int index) {
+    constexpr int quarter = Ppg::dataLength >> 2;
+    index %= Ppg::dataLength;
+    if (index < quarter) {
+      return quarterSine[index];
+    }
+    if (index < 2 * quarter) {
+      return quarterSine[2 * quarter - index];
+    }
+    if (index < 3 * quarter) {
+      return -quarterSine[index - 2 * quarter];
+    }
+    return -quarterSine[Ppg::dataLength - index];
+  }
+
+  float Cosine(int index) {
+    return Sine(index + (Ppg::dataLength >> 2));
+  }
 }
 
 Ppg::Ppg() {
   dataAverage.fill(0.0f);
   spectrum.fill(0.0f);
+  ResetIncremental();
 }
 
 int8_t Ppg::Preprocess(uint32_t hrs, uint32_t als) {
-  if (dataIndex < dataLength) {
+  if (mode == Modes::Incremental) {
+    PushSample(hrs);
+  } else if (dataIndex < dataLength) {
     dataHRS[dataIndex++] = hrs;
   }
   alsValue = als;
@@ -154,6 +158,25 @@ int8_t Ppg::Preprocess(uint32_t hrs, uint32_t als) {
 }
 
 int Ppg::HeartRate() {
+  if (mode == Modes::Incremental) {
+    if (samplesBeforeEstimate > 0) {
+      return 0;
+    }
+    samplesBeforeEstimate = overlapWindow;
+
+    // Apply the Hanning window in the frequency domain: X[k] / 2 - (X[k - 1] + X[k + 1]) / 4
+    for (int idx = 0; idx < slidingBins - 1; idx++) {
+      const int prev = (idx == 0) ? 1 : idx - 1;
+      const float prevImag = (idx == 0) ? -binsImag[1] : binsImag[prev];
+      const float real = 0.5f * binsReal[idx] - 0.25f * (binsReal[prev] + binsReal[idx + 1]);
+      const float imag = 0.5f * binsImag[idx] - 0.25f * (prevImag + binsImag[idx + 1]);
+      vImag[idx] = std::sqrt(real * real + imag * imag);
+    }
+    int hr = EstimateHeartRate(vImag.data(), slidingBins - 1, resetSpectralAvg);
+    resetSpectralAvg = false;
+    return hr;
+  }
+
   if (dataIndex < dataLength) {
     return 0;
   }
@@ -171,6 +194,7 @@ int Ppg::HeartRate() {
 void Ppg::Reset(bool resetDaqBuffer) {
   if (resetDaqBuffer) {
     dataIndex = 0;
+    ResetIncremental();
   }
   avgIndex = 0;
   dataAverage.fill(0.0f);
@@ -204,26 +228,19 @@ int Ppg::ProcessHeartRate(bool init) {
   FFT.compute(FFTDirection::Forward);
   FFT.complexToMagnitude();
   FFT.~ArduinoFFT();
-  SpectrumAverage(vReal.data(), spectrum.data(), spectrum.size(), init);
+  return EstimateHeartRate(vReal.data(), spectrum.size(), init);
+}
+
+int Ppg::EstimateHeartRate(const float* magnitudes, int length, bool init) {
+  SpectrumAverage(magnitudes, spectrum.data(), length, init);
   peakLocation = 0.0f;
   float threshold = peakDetectionThreshold;
   float peakWidth = 0.0f;
-  int specLen = spectrum.size();
   float max = SpectrumMax(spectrum, hrROIbegin, hrROIend);
   float signalToNoiseRatio = SignalToNoise(spectrum, hrROIbegin, hrROIend, max);
   if (signalToNoiseRatio > signalToNoiseThreshold && spectrum.at(0) < dcThreshold) {
     threshold *= max;
-    // Reuse VImag for interpolation x values passed to PeakSearch
-    for (int idx = 0; idx < dataLength; idx++) {
-      vImag[idx] = idx;
-    }
-    peakLocation = PeakSearch(vImag.data(),
-                              spectrum.data(),
-                              threshold,
-                              peakWidth,
-                              static_cast<float>(hrROIbegin),
-                              static_cast<float>(hrROIend),
-                              specLen);
+    peakLocation = PeakSearch(spectrum.data(), threshold, peakWidth, hrROIbegin, hrROIend);
     peakLocation *= freqResolution;
   }
   // Peak too wide? (broad spectrum noise or large, rapid HR change)
@@ -252,6 +269,82 @@ int Ppg::ProcessHeartRate(bool init) {
   return rtn;
 }
 
+void Ppg::SetMode(Modes newMode) {
+  if (mode != newMode) {
+    mode = newMode;
+    Reset(true);
+  }
+}
+
+// Runs the same filters as Detrend() and Filter30to240() on a stream of samples, and updates the
+// DFT bins of the last dataLength filtered samples in O(slidingBins).
+void Ppg::PushSample(uint16_t hrs) {
+  float sample = static_cast<float>(hrs);
+  // The derivative removes the linear trend. There's no previous sample right after a reset.
+  float value = (samplesBeforeEstimate == dataLength) ? 0.0f : sample - previousSample;
+  previousSample = sample;
+
+  // Same cutoff frequencies as Filter30to240()
+  for (float& state : lowPass) {
+    state = 0.816f * value + (1 - 0.816f) * state;
+    value = state;
+  }
+  for (float& state : highPass) {
+    state = 0.268f * value + (1 - 0.268f) * state;
+    value -= state;
+  }
+
+  const float delta = value - vReal[historyIndex];
+  vReal[historyIndex] = value;
+  historyIndex = (historyIndex + 1) % dataLength;
+
+  // S[k] = (S[k] + x[n] - x[n - N]) * e^(2 * pi * i * k / N)
+  for (int idx = 0; idx < slidingBins; idx++) {
+    const float real = binsReal[idx] + delta;
+    const float imag = binsImag[idx];
+    const float cosine = Cosine(idx);
+    const float sine = Sine(idx);
+    binsReal[idx] = real * cosine - imag * sine;
+    binsImag[idx] = real * sine + imag * cosine;
+  }
+
+  // Rounding errors accumulate in the sliding DFT, recompute the bins from the samples regularly
+  if (--samplesBeforeRefresh == 0) {
+    samplesBeforeRefresh = dataLength;
+    RefreshBins();
+  }
+  if (samplesBeforeEstimate > 0) {
+    samplesBeforeEstimate--;
+  }
+}
+
+void Ppg::RefreshBins() {
+  for (int idx = 0; idx < slidingBins; idx++) {
+    float real = 0.0f;
+    float imag = 0.0f;
+    for (int sampleIdx = 0; sampleIdx < dataLength; sampleIdx++) {
+      // The oldest sample is at historyIndex
+      const float value = vReal[(historyIndex + sampleIdx) % dataLength];
+      real += value * Cosine(idx * sampleIdx);
+      imag -= value * Sine(idx * sampleIdx);
+    }
+    binsReal[idx] = real;
+    binsImag[idx] = imag;
+  }
+}
+
+void Ppg::ResetIncremental() {
+  vReal.fill(0.0f);
+  binsReal.fill(0.0f);
+  binsImag.fill(0.0f);
+  lowPass.fill(0.0f);
+  highPass.fill(0.0f);
+  previousSample = 0.0f;
+  historyIndex = 0;
+  samplesBeforeRefresh = dataLength;
+  samplesBeforeEstimate = dataLength;
+}
+
 void Ppg::SpectrumAverage(const float* data, float* spectrum, int length, bool reset) {
   if (reset) {
     spectralAvgCount = 0;
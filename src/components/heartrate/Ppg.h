@@ -13,10 +13,16 @@ namespace Pinetime {
   namespace Controllers {
     class Ppg {
     public:
+      // Batch recomputes the whole spectrum of the last dataLength samples for each estimate.
+      // Incremental filters each sample as it arrives and updates the heart rate bins with a
+      // sliding DFT, which is much cheaper for continuous measurements.
+      enum class Modes : uint8_t { Batch, Incremental };
+
       Ppg();
       int8_t Preprocess(uint32_t hrs, uint32_t als);
       int HeartRate();
       void Reset(bool resetDaqBuffer);
+      void SetMode(Modes newMode);
       static constexpr int deltaTms = 100;
       // Daq dataLength: Must be power of 2
       static constexpr uint16_t dataLength = 64;
@@ -51,6 +57,10 @@ namespace Pinetime {
       static constexpr float dcThreshold = 0.5f;
       // ALS detection factor
       static constexpr float alsFactor = 2.0f;
+      // Bins updated by the sliding DFT: DC up to the end of the ROI, plus one neighbour for the Hanning window
+      static constexpr uint16_t slidingBins = hrROIend + 2;
+      // Number of cascaded stages of each exponential filter
+      static constexpr uint8_t filterStages = 4;
 
       // Raw ADC data
       std::array<uint16_t, dataLength> dataHRS;
@@ -63,6 +73,17 @@ namespace Pinetime {
       // Stores each new HR value (Hz). Non zero values are averaged for HR output
       std::array<float, 20> dataAverage;
 
+      // Incremental mode: vReal holds the last dataLength filtered samples and vImag the magnitudes
+      std::array<float, slidingBins> binsReal;
+      std::array<float, slidingBins> binsImag;
+      std::array<float, filterStages> lowPass;
+      std::array<float, filterStages> highPass;
+      float previousSample = 0.0f;
+      uint16_t historyIndex = 0;
+      uint16_t samplesBeforeRefresh = dataLength;
+      uint16_t samplesBeforeEstimate = dataLength;
+      Modes mode = Modes::Batch;
+
       uint16_t avgIndex = 0;
       uint16_t spectralAvgCount = 0;
       float lastPeakLocation = 0.0f;
@@ -73,6 +94,10 @@ namespace Pinetime {
       bool resetSpectralAvg = true;
 
       int ProcessHeartRate(bool init);
+      int EstimateHeartRate(const float* magnitudes, int length, bool init);
+      void PushSample(uint16_t hrs);
+      void RefreshBins();
+      void ResetIncremental();
       float HeartRateAverage(float hr);
       void SpectrumAverage(const float* data, float* spectrum, int length, bool reset);
     };
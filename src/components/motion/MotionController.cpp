@@ -1,5 +1,6 @@
 #include "components/motion/MotionController.h"
 
+#include <algorithm>
 #include <task.h>
 
 #include "utility/Math.h"
@@ -36,31 +37,55 @@ namespace {
 }
 
 void MotionController::Update(int16_t x, int16_t y, int16_t z, uint32_t nbSteps) {
+  const Sample sample {x, y, z};
+  UpdateBatch({&sample, 1}, nbSteps);
+}
+
+void MotionController::UpdateBatch(std::span<const Sample> samples, uint32_t nbSteps) {
+  if (samples.empty()) {
+    return;
+  }
+
+  const Sample& latest = samples.back();
   if (this->nbSteps != nbSteps && service != nullptr) {
     service->OnNewStepCountValue(nbSteps);
   }
 
-  if (service != nullptr && (this->x != x || yHistory[0] != y || zHistory[0] != z)) {
-    service->OnNewMotionValues(x, y, z);
+  if (service != nullptr && (this->x != latest.x || yHistory[0] != latest.y || zHistory[0] != latest.z)) {
+    service->OnNewMotionValues(latest.x, latest.y, latest.z);
   }
 
   lastTime = time;
   time = xTaskGetTickCount();
-
-  lastX = this->x;
-  this->x = x;
-  yHistory++;
-  yHistory[0] = y;
-  zHistory++;
-  zHistory[0] = z;
-
-  stats = GetAccelStats();
+  // The samples of a batch were measured at a regular interval since the previous update
+  const TickType_t sampleInterval = std::max<TickType_t>((time - lastTime) / samples.size(), 1);
+
+  peakShakeSpeed = 0;
+  raiseWake = false;
+  lowerSleep = false;
+  for (const Sample& sample : samples) {
+    lastX = this->x;
+    this->x = sample.x;
+    yHistory++;
+    yHistory[0] = sample.y;
+    zHistory++;
+    zHistory[0] = sample.z;
+
+    stats = GetAccelStats();
+    UpdateShakeSpeed(sampleInterval);
+    peakShakeSpeed = std::max(peakShakeSpeed, accumulatedSpeed);
+    raiseWake = raiseWake || IsRaiseWakeGesture();
+    lowerSleep = lowerSleep || IsLowerSleepGesture();
+  }
 
   int32_t deltaSteps = nbSteps - this->nbSteps;
   if (deltaSteps > 0) {
     currentTripSteps += deltaSteps;
   }
-  this->nbSteps = nbSteps;
+  if (this->nbSteps != nbSteps) {
+    this->nbSteps = nbSteps;
+    changeNotifier.Publish(ChangeNotifier::Topic::Steps);
+  }
 }
 
 MotionController::AccelStats MotionController::GetAccelStats() const {
@@ -87,7 +112,7 @@ MotionController::AccelStats MotionController::GetAccelStats() const {
   return stats;
 }
 
-bool MotionController::ShouldRaiseWake() const {
+bool MotionController::IsRaiseWakeGesture() const {
   constexpr uint32_t varianceThresh = 56 * 56;
   constexpr int16_t xThresh = 384;
   constexpr int16_t yThresh = -64;
@@ -105,17 +130,15 @@ bool MotionController::ShouldRaiseWake() const {
   return DegreesRolled(stats.yMean, stats.zMean, stats.prevYMean, stats.prevZMean) < rollDegreesThresh;
 }
 
-bool MotionController::ShouldShakeWake(uint16_t thresh) {
-  /* Currently Polling at 10hz, If this ever goes faster scalar and EMA might need adjusting */
+void MotionController::UpdateShakeSpeed(TickType_t sampleInterval) {
+  /* Currently sampling at 12.5hz, If this ever goes faster scalar and EMA might need adjusting */
   int32_t speed =
-    std::abs(zHistory[0] - zHistory[histSize - 1] + (yHistory[0] - yHistory[histSize - 1]) / 2 + (x - lastX) / 4) * 100 / (time - lastTime);
+    std::abs(zHistory[0] - zHistory[histSize - 1] + (yHistory[0] - yHistory[histSize - 1]) / 2 + (x - lastX) / 4) * 100 / sampleInterval;
   // (.2 * speed) + ((1 - .2) * accumulatedSpeed);
   accumulatedSpeed = speed / 5 + accumulatedSpeed * 4 / 5;
-
-  return accumulatedSpeed > thresh;
 }
 
-bool MotionController::ShouldLowerSleep() const {
+bool MotionController::IsLowerSleepGesture() const {
   if (stats.yMean < 724 || DegreesRolled(stats.yMean, stats.zMean, stats.prevYMean, stats.prevZMean) < 30) {
     return false;
   }
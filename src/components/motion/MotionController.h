@@ -1,11 +1,13 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
 #include <FreeRTOS.h>
 
 #include "drivers/Bma421.h"
 #include "components/ble/MotionService.h"
+#include "components/events/ChangeNotifier.h"
 #include "utility/CircularBuffer.h"
 
 namespace Pinetime {
@@ -18,7 +20,15 @@ namespace Pinetime {
         BMA425,
       };
 
+      using Sample = Pinetime::Drivers::Bma421::Sample;
+
+      explicit MotionController(ChangeNotifier& changeNotifier) : changeNotifier {changeNotifier} {
+      }
+
       void Update(int16_t x, int16_t y, int16_t z, uint32_t nbSteps);
+      // Processes samples read since the previous update (oldest first). The wake gestures are evaluated
+      // after each sample: the Should*() functions report whether one was detected anywhere in the batch.
+      void UpdateBatch(std::span<const Sample> samples, uint32_t nbSteps);
 
       int16_t X() const {
         return x;
@@ -44,9 +54,17 @@ namespace Pinetime {
         return currentTripSteps;
       }
 
-      bool ShouldShakeWake(uint16_t thresh);
-      bool ShouldRaiseWake() const;
-      bool ShouldLowerSleep() const;
+      bool ShouldShakeWake(uint16_t thresh) const {
+        return peakShakeSpeed > thresh;
+      }
+
+      bool ShouldRaiseWake() const {
+        return raiseWake;
+      }
+
+      bool ShouldLowerSleep() const {
+        return lowerSleep;
+      }
 
       int32_t CurrentShakeSpeed() const {
         return accumulatedSpeed;
@@ -67,6 +85,7 @@ namespace Pinetime {
       }
 
     private:
+      ChangeNotifier& changeNotifier;
       uint32_t nbSteps = 0;
       uint32_t currentTripSteps = 0;
 
@@ -86,6 +105,9 @@ namespace Pinetime {
       };
 
       AccelStats GetAccelStats() const;
+      void UpdateShakeSpeed(TickType_t sampleInterval);
+      bool IsRaiseWakeGesture() const;
+      bool IsLowerSleepGesture() const;
 
       AccelStats stats = {};
 
@@ -95,6 +117,9 @@ namespace Pinetime {
       Utility::CircularBuffer<int16_t, histSize> yHistory = {};
       Utility::CircularBuffer<int16_t, histSize> zHistory = {};
       int32_t accumulatedSpeed = 0;
+      int32_t peakShakeSpeed = 0;
+      bool raiseWake = false;
+      bool lowerSleep = false;
 
       DeviceTypes deviceType = DeviceTypes::Unknown;
       Pinetime::Controllers::MotionService* service = nullptr;
@@ -0,0 +1,116 @@
+#include "components/motion/StepHistory.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include "components/datetime/DateTimeController.h"
+#include "components/fs/FS.h"
+
+using namespace Pinetime::Controllers;
+
+StepHistory::StepHistory(FS& fs, DateTime& dateTimeController) : fs {fs}, dateTimeController {dateTimeController} {
+}
+
+void StepHistory::Init() {
+  LoadFromFile();
+}
+
+void StepHistory::Update(uint32_t nbSteps) {
+  // The counter goes back to 0 at midnight
+  const uint32_t newSteps = (nbSteps >= lastNbSteps) ? nbSteps - lastNbSteps : nbSteps;
+  lastNbSteps = nbSteps;
+  if (newSteps == 0) {
+    return;
+  }
+
+  const uint32_t hour = CurrentHour();
+  if (!Advance(hour)) {
+    return;
+  }
+  auto& bucket = history.steps[hour % nbHours];
+  bucket = static_cast<uint16_t>(std::min<uint32_t>(bucket + newSteps, UINT16_MAX));
+  historyChanged = true;
+}
+
+void StepHistory::SaveIfChanged() {
+  if (historyChanged) {
+    SaveToFile();
+    historyChanged = false;
+  }
+}
+
+uint16_t StepHistory::StepsInHour(uint16_t hoursAgo) const {
+  const uint32_t now = CurrentHour();
+  if (hoursAgo >= nbHours || hoursAgo > now) {
+    return 0;
+  }
+  return StepsAt(now - hoursAgo);
+}
+
+uint32_t StepHistory::StepsInDay(uint8_t daysAgo) const {
+  const uint32_t now = CurrentHour();
+  const uint32_t dayStart = now - now % 24;
+  if (daysAgo >= nbDays || daysAgo * 24u > dayStart) {
+    return 0;
+  }
+
+  uint32_t total = 0;
+  for (uint32_t hour = dayStart - daysAgo * 24u; hour < dayStart - daysAgo * 24u + 24 && hour <= now; hour++) {
+    total += StepsAt(hour);
+  }
+  return total;
+}
+
+uint32_t StepHistory::CurrentHour() const {
+  const auto sinceEpoch = dateTimeController.CurrentDateTime().time_since_epoch();
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::hours>(sinceEpoch).count());
+}
+
+uint16_t StepHistory::StepsAt(uint32_t hour) const {
+  // Buckets are only cleared when steps are counted, so the most recent hours may not be in the buffer yet
+  if (hour > history.hour || history.hour - hour >= nbHours) {
+    return 0;
+  }
+  return history.steps[hour % nbHours];
+}
+
+bool StepHistory::Advance(uint32_t hour) {
+  if (hour <= history.hour) {
+    // The time was set back. The steps are added to the buckets already recorded for this hour, unless
+    // it is older than the whole history, which happens when the time isn't set yet after a cold boot.
+    return history.hour - hour < nbHours;
+  }
+
+  if (hour - history.hour < nbHours) {
+    for (uint32_t h = history.hour + 1; h <= hour; h++) {
+      history.steps[h % nbHours] = 0;
+    }
+  } else {
+    history.steps.fill(0);
+  }
+  history.hour = hour;
+  return true;
+}
+
+void StepHistory::LoadFromFile() {
+  HistoryData bufferHistory;
+  lfs_file_t historyFile;
+
+  if (fs.FileOpen(&historyFile, "/stephist.dat", LFS_O_RDONLY) != LFS_ERR_OK) {
+    return;
+  }
+  fs.FileRead(&historyFile, reinterpret_cast<uint8_t*>(&bufferHistory), sizeof(history));
+  fs.FileClose(&historyFile);
+  if (bufferHistory.version == historyVersion) {
+    history = bufferHistory;
+  }
+}
+
+void StepHistory::SaveToFile() {
+  lfs_file_t historyFile;
+
+  if (fs.FileOpen(&historyFile, "/stephist.dat", LFS_O_WRONLY | LFS_O_CREAT) != LFS_ERR_OK) {
+    return;
+  }
+  fs.FileWrite(&historyFile, reinterpret_cast<uint8_t*>(&history), sizeof(history));
+  fs.FileClose(&historyFile);
+}
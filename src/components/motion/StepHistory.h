@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Pinetime {
+  namespace Controllers {
+    class FS;
+    class DateTime;
+
+    // Number of steps per hour over the last week, in a ring buffer indexed by the local hour.
+    // The buffer is only written to the flash when a new hour starts, and only if steps were
+    // counted since the previous write. When the watch sleeps at that moment, the write is deferred
+    // until it wakes up.
+    class StepHistory {
+    public:
+      static constexpr uint8_t nbDays = 7;
+      static constexpr uint16_t nbHours = nbDays * 24;
+
+      StepHistory(FS& fs, DateTime& dateTimeController);
+
+      void Init();
+      // nbSteps is the value of the step counter, which is reset at midnight
+      void Update(uint32_t nbSteps);
+      // Writes the buffer to the flash if steps were counted since the previous write.
+      // The SPI and the flash must be awake: don't call it while the system sleeps.
+      // The file is written through Controllers::FS, whose lock serializes it with the reads of the display task.
+      void SaveIfChanged();
+
+      // Steps counted during the hour that started `hoursAgo` hours before the current one
+      uint16_t StepsInHour(uint16_t hoursAgo) const;
+      // Steps counted during the day that started `daysAgo` days before today (0 for today).
+      // Only reads the buffer in RAM: the Steps screen can call it for each bar of a weekly chart.
+      uint32_t StepsInDay(uint8_t daysAgo) const;
+
+    private:
+      static constexpr uint32_t historyVersion = 1;
+
+      struct HistoryData {
+        uint32_t version = historyVersion;
+        // Hours since the epoch (local time) of the most recent bucket
+        uint32_t hour = 0;
+        std::array<uint16_t, nbHours> steps {};
+      };
+
+      uint32_t CurrentHour() const;
+      uint16_t StepsAt(uint32_t hour) const;
+      bool Advance(uint32_t hour);
+      void LoadFromFile();
+      void SaveToFile();
+
+      FS& fs;
+      DateTime& dateTimeController;
+      HistoryData history;
+      uint32_t lastNbSteps = 0;
+      bool historyChanged = false;
+    };
+  }
+}
@@ -1,4 +1,6 @@
 #include "components/rle/RleDecoder.h"
+#include <algorithm>
+#include "utility/Rgb565.h"
 
 using namespace Pinetime::Tools;
 
@@ -12,13 +14,13 @@ RleDecoder::RleDecoder(const uint8_t* buffer, size_t size, uint16_t foregroundCo
 
 void RleDecoder::DecodeNext(uint8_t* output, size_t maxBytes) {
   for (; encodedBufferIndex < size; encodedBufferIndex++) {
-    uint8_t rl = buffer[encodedBufferIndex] - processedCount;
-    while (rl) {
-      output[bp] = color >> 8;
-      output[bp + 1] = color & 0xff;
-      bp += 2;
-      rl -= 1;
-      processedCount++;
+    size_t remainingInRun = buffer[encodedBufferIndex] - processedCount;
+    if (remainingInRun > 0) {
+      // Fill as much of the run as the output buffer can take at once
+      size_t pixels = std::min(remainingInRun, (maxBytes - bp + 1) / 2);
+      Fill(output + bp, pixels);
+      bp += pixels * 2;
+      processedCount += pixels;
 
       if (bp >= maxBytes) {
         bp = 0;
@@ -34,3 +36,15 @@ void RleDecoder::DecodeNext(uint8_t* output, size_t maxBytes) {
       color = backgroundColor;
   }
 }
+
+void RleDecoder::Fill(uint8_t* output, size_t pixels) const {
+  if ((reinterpret_cast<uintptr_t>(output) & 0x01u) == 0) {
+    Pinetime::Utility::Rgb565::Fill(reinterpret_cast<uint16_t*>(output), pixels, color);
+    return;
+  }
+
+  for (size_t i = 0; i < pixels; i++) {
+    output[i * 2] = color >> 8;
+    output[(i * 2) + 1] = color & 0xff;
+  }
+}
@@ -7,6 +7,7 @@ namespace Pinetime {
   namespace Tools {
     /* 1-bit RLE decoder. Provide the encoded buffer to the constructor and then call DecodeNext() by
      * specifying the output (decoded) buffer and the maximum number of bytes this buffer can handle.
+     * Runs are written with 32-bit stores, the pixels are output most significant byte first.
      *
      * Code from https://github.com/daniel-thompson/wasp-bootloader by Daniel Thompson released under the MIT license.
      */
@@ -18,6 +19,8 @@ namespace Pinetime {
       void DecodeNext(uint8_t* output, size_t maxBytes);
 
     private:
+      void Fill(uint8_t* output, size_t pixels) const;
+
       const uint8_t* buffer;
       size_t size;
 
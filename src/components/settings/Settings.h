@@ -225,6 +225,18 @@ namespace Pinetime {
         return settings.shakeWakeThreshold;
       }
 
+      // Minutes between two background heart rate measurements, 0 when they are disabled
+      void SetHeartRateBackgroundMeasurementInterval(uint16_t minutes) {
+        if (settings.heartRateBackgroundMeasurementInterval != minutes) {
+          settings.heartRateBackgroundMeasurementInterval = minutes;
+          settingsChanged = true;
+        }
+      }
+
+      uint16_t GetHeartRateBackgroundMeasurementInterval() const {
+        return settings.heartRateBackgroundMeasurementInterval;
+      }
+
       void setWakeUpMode(WakeUpMode wakeUp, bool enabled) {
         if (enabled != isWakeUpModeOn(wakeUp)) {
           settingsChanged = true;
@@ -286,7 +298,7 @@ namespace Pinetime {
     private:
       Pinetime::Controllers::FS& fs;
 
-      static constexpr uint32_t settingsVersion = 0x0007;
+      static constexpr uint32_t settingsVersion = 0x0008;
 
       struct SettingsData {
         uint32_t version = settingsVersion;
@@ -306,6 +318,7 @@ namespace Pinetime {
 
         std::bitset<5> wakeUpMode {0};
         uint16_t shakeWakeThreshold = 150;
+        uint16_t heartRateBackgroundMeasurementInterval = 0;
 
         Controllers::BrightnessController::Levels brightLevel = Controllers::BrightnessController::Levels::Medium;
       };
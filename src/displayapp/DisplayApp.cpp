@@ -46,6 +46,7 @@
 #include "displayapp/screens/settings/SettingSteps.h"
 #include "displayapp/screens/settings/SettingSetDateTime.h"
 #include "displayapp/screens/settings/SettingChimes.h"
+#include "displayapp/screens/settings/SettingHeartRate.h"
 #include "displayapp/screens/settings/SettingShakeThreshold.h"
 #include "displayapp/screens/settings/SettingBluetooth.h"
 
@@ -64,8 +65,53 @@ namespace {
     auto* dispApp = static_cast<DisplayApp*>(pvTimerGetTimerID(xTimer));
     dispApp->PushMessage(Display::Messages::TimerDone);
   }
+
+  void ChangesCallback(void* instance) {
+    static_cast<DisplayApp*>(instance)->PushMessage(Display::Messages::ValuesChanged);
+  }
+
+  // Screens created by LoadScreen() besides the user apps and watch faces
+  template <typename... Ts>
+  struct ScreenTypes {
+    static constexpr size_t largest = std::max({sizeof(Ts)...});
+
+    template <typename T>
+    static constexpr bool contains = (std::is_same_v<T, Ts> || ...);
+  };
+
+  using BuiltInScreens = ScreenTypes<Screens::ApplicationList,
+                                     Screens::Error,
+                                     Screens::FirmwareValidation,
+                                     Screens::FirmwareUpdate,
+                                     Screens::PassKey,
+                                     Screens::Notifications,
+                                     Screens::QuickSettings,
+                                     Screens::Settings,
+                                     Screens::SettingWatchFace,
+                                     Screens::SettingTimeFormat,
+                                     Screens::SettingWeatherFormat,
+                                     Screens::SettingWakeUp,
+                                     Screens::SettingDisplay,
+                                     Screens::SettingSteps,
+                                     Screens::SettingSetDateTime,
+                                     Screens::SettingChimes,
+                                     Screens::SettingHeartRate,
+                                     Screens::SettingShakeThreshold,
+                                     Screens::SettingBluetooth,
+                                     Screens::BatteryInfo,
+                                     Screens::SystemInfo,
+                                     Screens::FlashLight>;
+
+  // The arena is only large enough for the screens listed in BuiltInScreens
+  template <typename T, typename... Args>
+  Screens::Screen* CreateBuiltInScreen(Args&&... args) {
+    static_assert(BuiltInScreens::contains<T>, "Add the screen to BuiltInScreens");
+    return ScreenArena::Create<T>(std::forward<Args>(args)...);
+  }
 }
 
+alignas(std::max_align_t) std::byte ScreenArena::storage[std::max(BuiltInScreens::largest, largestUserScreen)];
+
 DisplayApp::DisplayApp(Drivers::St7789& lcd,
                        const Drivers::Cst816S& touchPanel,
                        const Controllers::Battery& batteryController,
@@ -80,7 +126,8 @@ DisplayApp::DisplayApp(Drivers::St7789& lcd,
                        Pinetime::Controllers::AlarmController& alarmController,
                        Pinetime::Controllers::BrightnessController& brightnessController,
                        Pinetime::Controllers::TouchHandler& touchHandler,
-                       Pinetime::Controllers::FS& filesystem)
+                       Pinetime::Controllers::FS& filesystem,
+                       Pinetime::Controllers::ChangeNotifier& changeNotifier)
   : lcd {lcd},
     touchPanel {touchPanel},
     batteryController {batteryController},
@@ -96,6 +143,7 @@ DisplayApp::DisplayApp(Drivers::St7789& lcd,
     brightnessController {brightnessController},
     touchHandler {touchHandler},
     filesystem {filesystem},
+    changeNotifier {changeNotifier},
     lvgl {lcd, filesystem},
     timer(this, TimerCallback),
     controllers {batteryController,
@@ -120,6 +168,7 @@ DisplayApp::DisplayApp(Drivers::St7789& lcd,
 
 void DisplayApp::Start(System::BootErrors error) {
   msgQueue = xQueueCreate(queueSize, itemSize);
+  changeNotifier.SetWakeUpCallback(ChangesCallback, this);
 
   bootError = error;
 
@@ -202,6 +251,27 @@ void DisplayApp::Refresh() {
     return lv_disp_get_inactive_time(nullptr) >= pdMS_TO_TICKS(settingsController.GetScreenTimeOut());
   };
 
+  auto TicksUntilInactivityTimeout = [this]() -> TickType_t {
+    const uint32_t inactiveTime = lv_disp_get_inactive_time(nullptr);
+    const uint32_t dimTime = pdMS_TO_TICKS(settingsController.GetScreenTimeOut() - 2000);
+    const uint32_t sleepTime = pdMS_TO_TICKS(settingsController.GetScreenTimeOut());
+    if (inactiveTime < dimTime) {
+      return dimTime - inactiveTime;
+    }
+    if (inactiveTime < sleepTime) {
+      return sleepTime - inactiveTime;
+    }
+    return 0;
+  };
+
+  // Screens that subscribe to changes are refreshed by OnChanges(), so LVGL only needs to run
+  // when something was invalidated or while the user interacts with the screen
+  auto CanPauseLvgl = [this]() -> bool {
+    return currentScreen->Subscriptions() != 0 && !touchHandler.IsTouching() &&
+           lv_disp_get_inactive_time(nullptr) >= pdMS_TO_TICKS(lvglPauseDelay) && lv_anim_count_running() == 0 &&
+           !lvgl.IsRefreshPending();
+  };
+
   TickType_t queueTimeout;
   switch (state) {
     case States::Idle:
@@ -212,6 +282,11 @@ void DisplayApp::Refresh() {
         LoadPreviousScreen();
       }
       queueTimeout = lv_task_handler();
+      if (lvgl.IsPaused() && lvgl.IsRefreshPending()) {
+        // A task of the screen modified it
+        lvgl.Resume();
+        queueTimeout = 0;
+      }
 
       if (!systemTask->IsSleepDisabled() && IsPastDimTime()) {
         if (!isDimmed) {
@@ -224,6 +299,14 @@ void DisplayApp::Refresh() {
       } else if (isDimmed) {
         RestoreBrightness();
       }
+
+      if (CanPauseLvgl()) {
+        lvgl.Pause();
+      }
+      if (lvgl.IsPaused() && !systemTask->IsSleepDisabled()) {
+        // Nothing else wakes the display task up when it's time to dim the screen or to go to sleep
+        queueTimeout = std::min(queueTimeout, TicksUntilInactivityTimeout());
+      }
       break;
     default:
       queueTimeout = portMAX_DELAY;
@@ -232,6 +315,10 @@ void DisplayApp::Refresh() {
 
   Messages msg;
   if (xQueueReceive(msgQueue, &msg, queueTimeout) == pdTRUE) {
+    if (msg != Messages::ValuesChanged) {
+      lvgl.Resume();
+    }
+
     switch (msg) {
       case Messages::DimScreen:
         DimScreen();
@@ -246,6 +333,7 @@ void DisplayApp::Refresh() {
         }
         lcd.Sleep();
         PushMessageToSystemTask(Pinetime::System::Messages::OnDisplayTaskSleeping);
+        changeNotifier.Subscribe(0);
         state = States::Idle;
         break;
       case Messages::GoToRunning:
@@ -253,6 +341,11 @@ void DisplayApp::Refresh() {
         lv_disp_trig_activity(nullptr);
         ApplyBrightness();
         state = States::Running;
+        // Catch up with the changes that happened while sleeping
+        changeNotifier.Subscribe(currentScreen->Subscriptions());
+        if (currentScreen->Subscriptions() != 0) {
+          currentScreen->OnChanges(currentScreen->Subscriptions());
+        }
         break;
       case Messages::UpdateBleConnection:
         //        clockScreen.SetBleConnectionState(bleController.IsConnected() ? Screens::Clock::BleConnectionStates::Connected :
@@ -383,6 +476,19 @@ void DisplayApp::Refresh() {
         RestoreBrightness();
         motorController.RunForDuration(15);
         break;
+      case Messages::ValuesChanged:
+        // Handled below, the changes are taken at each iteration
+        break;
+    }
+  }
+
+  if (state == States::Running) {
+    const auto changes = changeNotifier.Take();
+    if (changes != 0) {
+      currentScreen->OnChanges(changes);
+      if (lvgl.IsRefreshPending()) {
+        lvgl.Resume();
+      }
     }
   }
 
@@ -421,73 +527,60 @@ void DisplayApp::LoadScreen(Apps app, DisplayApp::FullRefreshDirections directio
   SetFullRefresh(direction);
 
   switch (app) {
-    case Apps::Launcher: {
-      std::array<Screens::Tile::Applications, UserAppTypes::Count> apps;
-      int i = 0;
-      for (const auto& userApp : userApps) {
-        apps[i++] = Screens::Tile::Applications {userApp.icon, userApp.app, true};
-      }
-      currentScreen = std::make_unique<Screens::ApplicationList>(this,
-                                                                 settingsController,
-                                                                 batteryController,
-                                                                 bleController,
-                                                                 dateTimeController,
-                                                                 filesystem,
-                                                                 std::move(apps));
-    } break;
-    case Apps::Clock: {
-      const auto* watchFace =
-        std::find_if(userWatchFaces.begin(), userWatchFaces.end(), [this](const WatchFaceDescription& watchfaceDescription) {
-          return watchfaceDescription.watchFace == settingsController.GetWatchFace();
-        });
-      if (watchFace != userWatchFaces.end())
-        currentScreen.reset(watchFace->create(controllers));
-      else {
-        currentScreen.reset(userWatchFaces[0].create(controllers));
-      }
-    } break;
+    case Apps::Launcher:
+      currentScreen.reset(CreateBuiltInScreen<Screens::ApplicationList>(this,
+                                                                        settingsController,
+                                                                        batteryController,
+                                                                        bleController,
+                                                                        dateTimeController,
+                                                                        filesystem,
+                                                                        std::array {userAppTiles}));
+      break;
+    case Apps::Clock:
+      currentScreen.reset(GetUserWatchFace(settingsController.GetWatchFace())(controllers));
+      break;
     case Apps::Error:
-      currentScreen = std::make_unique<Screens::Error>(bootError);
+      currentScreen.reset(CreateBuiltInScreen<Screens::Error>(bootError));
       break;
 
     case Apps::FirmwareValidation:
-      currentScreen = std::make_unique<Screens::FirmwareValidation>(validator);
+      currentScreen.reset(CreateBuiltInScreen<Screens::FirmwareValidation>(validator));
       break;
     case Apps::FirmwareUpdate:
-      currentScreen = std::make_unique<Screens::FirmwareUpdate>(bleController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::FirmwareUpdate>(bleController));
       break;
 
     case Apps::PassKey:
-      currentScreen = std::make_unique<Screens::PassKey>(bleController.GetPairingKey());
+      currentScreen.reset(CreateBuiltInScreen<Screens::PassKey>(bleController.GetPairingKey()));
       break;
 
     case Apps::Notifications:
-      currentScreen = std::make_unique<Screens::Notifications>(this,
-                                                               notificationManager,
-                                                               systemTask->nimble().alertService(),
-                                                               motorController,
-                                                               *systemTask,
-                                                               Screens::Notifications::Modes::Normal);
+      currentScreen.reset(CreateBuiltInScreen<Screens::Notifications>(this,
+                                                                      notificationManager,
+                                                                      systemTask->nimble().alertService(),
+                                                                      motorController,
+                                                                      *systemTask,
+                                                                      Screens::Notifications::Modes::Normal));
       break;
     case Apps::NotificationsPreview:
-      currentScreen = std::make_unique<Screens::Notifications>(this,
-                                                               notificationManager,
-                                                               systemTask->nimble().alertService(),
-                                                               motorController,
-                                                               *systemTask,
-                                                               Screens::Notifications::Modes::Preview);
+      currentScreen.reset(CreateBuiltInScreen<Screens::Notifications>(this,
+                                                                      notificationManager,
+                                                                      systemTask->nimble().alertService(),
+                                                                      motorController,
+                                                                      *systemTask,
+                                                                      Screens::Notifications::Modes::Preview));
       break;
     case Apps::QuickSettings:
-      currentScreen = std::make_unique<Screens::QuickSettings>(this,
-                                                               batteryController,
-                                                               dateTimeController,
-                                                               brightnessController,
-                                                               motorController,
-                                                               settingsController,
-                                                               bleController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::QuickSettings>(this,
+                                                                      batteryController,
+                                                                      dateTimeController,
+                                                                      brightnessController,
+                                                                      motorController,
+                                                                      settingsController,
+                                                                      bleController));
       break;
     case Apps::Settings:
-      currentScreen = std::make_unique<Screens::Settings>(this, settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::Settings>(this, settingsController));
       break;
     case Apps::SettingWatchFace: {
       std::array<Screens::SettingWatchFace::Item, UserWatchFaceTypes::Count> items;
@@ -496,57 +589,59 @@ void DisplayApp::LoadScreen(Apps app, DisplayApp::FullRefreshDirections directio
         items[i++] =
           Screens::SettingWatchFace::Item {userWatchFace.name, userWatchFace.watchFace, userWatchFace.isAvailable(controllers.filesystem)};
       }
-      currentScreen = std::make_unique<Screens::SettingWatchFace>(this, std::move(items), settingsController, filesystem);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingWatchFace>(this, std::move(items), settingsController, filesystem));
     } break;
     case Apps::SettingTimeFormat:
-      currentScreen = std::make_unique<Screens::SettingTimeFormat>(settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingTimeFormat>(settingsController));
       break;
     case Apps::SettingWeatherFormat:
-      currentScreen = std::make_unique<Screens::SettingWeatherFormat>(settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingWeatherFormat>(settingsController));
       break;
     case Apps::SettingWakeUp:
-      currentScreen = std::make_unique<Screens::SettingWakeUp>(settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingWakeUp>(settingsController));
       break;
     case Apps::SettingDisplay:
-      currentScreen = std::make_unique<Screens::SettingDisplay>(this, settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingDisplay>(this, settingsController));
       break;
     case Apps::SettingSteps:
-      currentScreen = std::make_unique<Screens::SettingSteps>(settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingSteps>(settingsController));
       break;
     case Apps::SettingSetDateTime:
-      currentScreen = std::make_unique<Screens::SettingSetDateTime>(this, dateTimeController, settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingSetDateTime>(this, dateTimeController, settingsController));
       break;
     case Apps::SettingChimes:
-      currentScreen = std::make_unique<Screens::SettingChimes>(settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingChimes>(settingsController));
+      break;
+    case Apps::SettingHeartRate:
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingHeartRate>(settingsController));
       break;
     case Apps::SettingShakeThreshold:
-      currentScreen = std::make_unique<Screens::SettingShakeThreshold>(settingsController, motionController, *systemTask);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingShakeThreshold>(settingsController, motionController, *systemTask));
       break;
     case Apps::SettingBluetooth:
-      currentScreen = std::make_unique<Screens::SettingBluetooth>(this, settingsController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SettingBluetooth>(this, settingsController));
       break;
     case Apps::BatteryInfo:
-      currentScreen = std::make_unique<Screens::BatteryInfo>(batteryController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::BatteryInfo>(batteryController));
       break;
     case Apps::SysInfo:
-      currentScreen = std::make_unique<Screens::SystemInfo>(this,
-                                                            dateTimeController,
-                                                            batteryController,
-                                                            brightnessController,
-                                                            bleController,
-                                                            watchdog,
-                                                            motionController,
-                                                            touchPanel);
+      currentScreen.reset(CreateBuiltInScreen<Screens::SystemInfo>(this,
+                                                                   dateTimeController,
+                                                                   batteryController,
+                                                                   brightnessController,
+                                                                   bleController,
+                                                                   watchdog,
+                                                                   motionController,
+                                                                   touchPanel,
+                                                                   lvgl));
       break;
     case Apps::FlashLight:
-      currentScreen = std::make_unique<Screens::FlashLight>(*systemTask, brightnessController);
+      currentScreen.reset(CreateBuiltInScreen<Screens::FlashLight>(*systemTask, brightnessController));
       break;
     default: {
-      const auto* d = std::find_if(userApps.begin(), userApps.end(), [app](const AppDescription& appDescription) {
-        return appDescription.app == app;
-      });
-      if (d != userApps.end()) {
-        currentScreen.reset(d->create(controllers));
+      const CreateScreen create = GetUserApp(app);
+      if (create != nullptr) {
+        currentScreen.reset(create(controllers));
       } else {
         currentScreen.reset(userWatchFaces[0].create(controllers));
       }
@@ -554,6 +649,11 @@ void DisplayApp::LoadScreen(Apps app, DisplayApp::FullRefreshDirections directio
     }
   }
   currentApp = app;
+
+  lvgl.Resume();
+  changeNotifier.Subscribe(currentScreen->Subscriptions());
+  // The new screen read the current values when it was created
+  changeNotifier.Take();
 }
 
 void DisplayApp::PushMessage(Messages msg) {
@@ -568,7 +668,9 @@ void DisplayApp::PushMessage(Messages msg) {
     // Make xQueueSend() non-blocking if the message is a Notification message. We do this to avoid
     // deadlock between SystemTask and DisplayApp when their respective message queues are getting full
     // when a lot of notifications are received on a very short time span.
-    if (msg == Messages::NewNotification) {
+    // ValuesChanged is sent by the controllers from any task, and the changes it signals are taken
+    // at the next iteration of the display task even if the message is dropped.
+    if (msg == Messages::NewNotification || msg == Messages::ValuesChanged) {
       timeout = static_cast<TickType_t>(0);
     }
 
@@ -12,8 +12,10 @@
 #include "components/firmwarevalidator/FirmwareValidator.h"
 #include "components/settings/Settings.h"
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/timer/Timer.h"
 #include "components/alarm/AlarmController.h"
+#include "components/events/ChangeNotifier.h"
 #include "touchhandler/TouchHandler.h"
 
 #include "displayapp/Messages.h"
@@ -66,7 +68,8 @@ namespace Pinetime {
                  Pinetime::Controllers::AlarmController& alarmController,
                  Pinetime::Controllers::BrightnessController& brightnessController,
                  Pinetime::Controllers::TouchHandler& touchHandler,
-                 Pinetime::Controllers::FS& filesystem);
+                 Pinetime::Controllers::FS& filesystem,
+                 Pinetime::Controllers::ChangeNotifier& changeNotifier);
       void Start(System::BootErrors error);
       void PushMessage(Display::Messages msg);
 
@@ -96,6 +99,7 @@ namespace Pinetime {
       Pinetime::Controllers::BrightnessController& brightnessController;
       Pinetime::Controllers::TouchHandler& touchHandler;
       Pinetime::Controllers::FS& filesystem;
+      Pinetime::Controllers::ChangeNotifier& changeNotifier;
 
       Pinetime::Controllers::FirmwareValidator validator;
       Pinetime::Components::LittleVgl lvgl;
@@ -110,7 +114,7 @@ namespace Pinetime {
       static constexpr uint8_t queueSize = 10;
       static constexpr uint8_t itemSize = 1;
 
-      std::unique_ptr<Screens::Screen> currentScreen;
+      ScreenPtr currentScreen;
 
       Apps currentApp = Apps::None;
       Apps returnToApp = Apps::None;
@@ -135,6 +139,10 @@ namespace Pinetime {
       Utility::StaticStack<FullRefreshDirections, returnAppStackSize> appStackDirections;
 
       bool isDimmed = false;
+
+      // Time without user interaction after which LVGL can be paused, so that it processes the release
+      // of the touch panel first
+      static constexpr uint32_t lvglPauseDelay = 1000;
     };
   }
 }
@@ -24,12 +24,14 @@ DisplayApp::DisplayApp(Drivers::St7789& lcd,
                        Pinetime::Controllers::AlarmController& /*alarmController*/,
                        Pinetime::Controllers::BrightnessController& /*brightnessController*/,
                        Pinetime::Controllers::TouchHandler& /*touchHandler*/,
-                       Pinetime::Controllers::FS& /*filesystem*/)
-  : lcd {lcd}, bleController {bleController} {
+                       Pinetime::Controllers::FS& /*filesystem*/,
+                       Pinetime::Controllers::ChangeNotifier& /*changeNotifier*/)
+  : lcd {lcd}, gfx {lcd}, bleController {bleController} {
 }
 
 void DisplayApp::Start() {
   msgQueue = xQueueCreate(queueSize, itemSize);
+  gfx.Init();
   if (pdPASS != xTaskCreate(DisplayApp::Process, "displayapp", 512, this, 0, &taskHandle))
     APP_ERROR_HANDLER(NRF_ERROR_NO_MEM);
 }
@@ -38,9 +40,6 @@ void DisplayApp::Process(void* instance) {
   auto* app = static_cast<DisplayApp*>(instance);
   NRF_LOG_INFO("displayapp task started!");
 
-  // Send a dummy notification to unlock the lvgl display driver for the first iteration
-  xTaskNotifyGive(xTaskGetCurrentTaskHandle());
-
   app->InitHw();
   while (true) {
     app->Refresh();
@@ -79,10 +78,10 @@ void DisplayApp::Refresh() {
         DisplayOtaProgress(percent, colorWhite);
         break;
       case Controllers::Ble::FirmwareUpdateStates::Validated:
-        DisplayOtaProgress(100, colorGreenSwapped);
+        DisplayOtaProgress(100, colorGreen);
         break;
       case Controllers::Ble::FirmwareUpdateStates::Error:
-        DisplayOtaProgress(100, colorRedSwapped);
+        DisplayOtaProgress(100, colorRed);
         break;
       default:
         break;
@@ -92,21 +91,20 @@ void DisplayApp::Refresh() {
 
 void DisplayApp::DisplayLogo(uint16_t color) {
   Pinetime::Tools::RleDecoder rleDecoder(infinitime_nb, sizeof(infinitime_nb), color, colorBlack);
-  for (int i = 0; i < displayWidth; i++) {
-    rleDecoder.DecodeNext(displayBuffer, displayWidth * bytesPerPixel);
-    ulTaskNotifyTake(pdTRUE, 500);
-    lcd.DrawBuffer(0, i, displayWidth, 1, reinterpret_cast<const uint8_t*>(displayBuffer), displayWidth * bytesPerPixel);
+  for (int i = 0; i < displayHeight; i++) {
+    uint8_t* line = displayBuffer[i % 2];
+    rleDecoder.DecodeNext(line, displayWidth * bytesPerPixel);
+    // The other buffer may still be drawn
+    gfx.WaitIdle();
+    gfx.FillRectangle(0, i, displayWidth, 1, line);
   }
+  gfx.WaitIdle();
 }
 
 void DisplayApp::DisplayOtaProgress(uint8_t percent, uint16_t color) {
   const uint8_t barHeight = 20;
-  std::fill(displayBuffer, displayBuffer + (displayWidth * bytesPerPixel), color);
-  for (int i = 0; i < barHeight; i++) {
-    ulTaskNotifyTake(pdTRUE, 500);
-    uint16_t barWidth = std::min(static_cast<float>(percent) * 2.4f, static_cast<float>(displayWidth));
-    lcd.DrawBuffer(0, displayWidth - barHeight + i, barWidth, 1, reinterpret_cast<const uint8_t*>(displayBuffer), barWidth * bytesPerPixel);
-  }
+  const auto barWidth = static_cast<uint8_t>(std::min(static_cast<float>(percent) * 2.4f, static_cast<float>(displayWidth)));
+  gfx.FillRectangle(0, displayHeight - barHeight, barWidth, barHeight, color);
 }
 
 void DisplayApp::PushMessage(Display::Messages msg) {
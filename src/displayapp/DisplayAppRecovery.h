@@ -37,6 +37,7 @@ namespace Pinetime {
     class SimpleWeatherService;
     class MusicService;
     class NavigationService;
+    class ChangeNotifier;
   }
 
   namespace System {
@@ -60,7 +61,8 @@ namespace Pinetime {
                  Pinetime::Controllers::AlarmController& alarmController,
                  Pinetime::Controllers::BrightnessController& brightnessController,
                  Pinetime::Controllers::TouchHandler& touchHandler,
-                 Pinetime::Controllers::FS& filesystem);
+                 Pinetime::Controllers::FS& filesystem,
+                 Pinetime::Controllers::ChangeNotifier& changeNotifier);
       void Start();
 
       void Start(Pinetime::System::BootErrors) {
@@ -81,6 +83,8 @@ namespace Pinetime {
       void InitHw();
       void Refresh();
       Pinetime::Drivers::St7789& lcd;
+      // Draws in its own task: the progress bar is redrawn without waiting for the display
+      Pinetime::Components::Gfx gfx;
       const Controllers::Ble& bleController;
 
       static constexpr uint8_t queueSize = 10;
@@ -92,12 +96,11 @@ namespace Pinetime {
 
       static constexpr uint16_t colorWhite = 0xFFFF;
       static constexpr uint16_t colorGreen = 0x07E0;
-      static constexpr uint16_t colorGreenSwapped = 0xE007;
       static constexpr uint16_t colorBlue = 0x0000ff;
-      static constexpr uint16_t colorRed = 0xff00;
-      static constexpr uint16_t colorRedSwapped = 0x00ff;
+      static constexpr uint16_t colorRed = 0xF800;
       static constexpr uint16_t colorBlack = 0x0000;
-      uint8_t displayBuffer[displayWidth * bytesPerPixel];
+      // A line of the logo is decoded while the previous one is drawn
+      uint8_t displayBuffer[2][displayWidth * bytesPerPixel];
     };
   }
 }
@@ -0,0 +1,447 @@
+#include "displayapp/ExternalFont.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Pinetime::Components;
+
+// Layout of the 'head' table, as written by lv_font_conv
+struct ExternalFont::FontHeader {
+  uint32_t version;
+  uint16_t tablesCount;
+  uint16_t fontSize;
+  uint16_t ascent;
+  int16_t descent;
+  uint16_t typoAscent;
+  int16_t typoDescent;
+  uint16_t typoLineGap;
+  int16_t minY;
+  int16_t maxY;
+  uint16_t defaultAdvanceWidth;
+  uint16_t kerningScale;
+  uint8_t indexToLocFormat;
+  uint8_t glyphIdFormat;
+  uint8_t advanceWidthFormat;
+  uint8_t bitsPerPixel;
+  uint8_t xyBits;
+  uint8_t whBits;
+  uint8_t advanceWidthBits;
+  uint8_t compressionId;
+  uint8_t subpixelsMode;
+  uint8_t padding;
+};
+
+namespace {
+  // Layout of a subtable entry of the 'cmap' table
+  struct CmapTable {
+    uint32_t dataOffset;
+    uint32_t rangeStart;
+    uint16_t rangeLength;
+    uint16_t glyphIdStart;
+    uint16_t dataEntriesCount;
+    uint8_t formatType;
+    uint8_t padding;
+  };
+
+  // Glyph records are bit-packed, most significant bit first
+  class BitReader {
+  public:
+    explicit BitReader(const uint8_t* data) : data {data} {
+    }
+
+    uint32_t Read(uint8_t nbBits) {
+      uint32_t value = 0;
+      for (uint8_t i = 0; i < nbBits; i++) {
+        value = (value << 1) | ((data[position / 8] >> (7 - (position % 8))) & 0x01u);
+        position++;
+      }
+      return value;
+    }
+
+    int32_t ReadSigned(uint8_t nbBits) {
+      uint32_t value = Read(nbBits);
+      if (nbBits > 0 && (value & (1u << (nbBits - 1))) != 0) {
+        value |= ~0u << nbBits;
+      }
+      return static_cast<int32_t>(value);
+    }
+
+  private:
+    const uint8_t* data;
+    uint32_t position = 0;
+  };
+
+  constexpr uint8_t maxGlyphHeaderSize = 8;
+  uint8_t emptyBitmap = 0;
+}
+
+lv_font_t* ExternalFont::Load(const char* path, uint8_t cacheSlots) {
+  auto* externalFont = new ExternalFont();
+  if (!externalFont->Open(path, cacheSlots)) {
+    delete externalFont;
+    return nullptr;
+  }
+  return &externalFont->font;
+}
+
+void ExternalFont::Free(lv_font_t* font) {
+  if (font != nullptr) {
+    delete static_cast<ExternalFont*>(font->user_data);
+  }
+}
+
+const ExternalFont::CacheStatistics& ExternalFont::GetCacheStatistics(const lv_font_t* font) {
+  return static_cast<const ExternalFont*>(font->user_data)->statistics;
+}
+
+ExternalFont::~ExternalFont() {
+  if (fileOpen) {
+    lv_fs_close(&file);
+  }
+
+  if (dsc.cmaps != nullptr) {
+    for (uint16_t i = 0; i < dsc.cmap_num; i++) {
+      if (dsc.cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+        delete[] static_cast<const uint16_t*>(dsc.cmaps[i].glyph_id_ofs_list);
+      } else {
+        delete[] static_cast<const uint8_t*>(dsc.cmaps[i].glyph_id_ofs_list);
+      }
+      delete[] dsc.cmaps[i].unicode_list;
+    }
+    delete[] dsc.cmaps;
+  }
+
+  if (dsc.kern_dsc != nullptr) {
+    if (dsc.kern_classes == 0) {
+      const auto* pairs = static_cast<const lv_font_fmt_txt_kern_pair_t*>(dsc.kern_dsc);
+      delete[] static_cast<const uint8_t*>(pairs->glyph_ids);
+      delete[] pairs->values;
+      delete pairs;
+    } else {
+      const auto* classes = static_cast<const lv_font_fmt_txt_kern_classes_t*>(dsc.kern_dsc);
+      delete[] classes->left_class_mapping;
+      delete[] classes->right_class_mapping;
+      delete[] classes->class_pair_values;
+      delete classes;
+    }
+  }
+
+  delete[] dsc.glyph_dsc;
+  delete[] glyphOffsets;
+  delete[] cacheEntries;
+  delete[] cacheBitmaps;
+}
+
+bool ExternalFont::Open(const char* path, uint8_t slots) {
+  if (lv_fs_open(&file, path, LV_FS_MODE_RD) != LV_FS_RES_OK) {
+    return false;
+  }
+  fileOpen = true;
+
+  uint32_t headerLength;
+  FontHeader header;
+  if (!ReadLabel(0, "head", headerLength) || !Read(&header, sizeof(header))) {
+    return false;
+  }
+
+  // Compressed bitmaps can't be decoded one glyph at a time
+  if (header.compressionId != 0 || (header.advanceWidthBits + 2 * header.xyBits + 2 * header.whBits) > maxGlyphHeaderSize * 8) {
+    return false;
+  }
+
+  font.user_data = this;
+  font.dsc = &dsc;
+  font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+  font.get_glyph_bitmap = GetGlyphBitmap;
+  font.base_line = -header.descent;
+  font.line_height = header.ascent - header.descent;
+  font.subpx = header.subpixelsMode;
+
+  dsc.bpp = header.bitsPerPixel;
+  dsc.kern_scale = header.kerningScale;
+  dsc.bitmap_format = header.compressionId;
+
+  uint32_t cmapsStart = headerLength;
+  uint32_t cmapsLength;
+  if (!LoadCmaps(cmapsStart, cmapsLength)) {
+    return false;
+  }
+
+  uint32_t locaStart = cmapsStart + cmapsLength;
+  uint32_t locaLength;
+  if (!LoadLoca(locaStart, locaLength, header.indexToLocFormat)) {
+    return false;
+  }
+
+  glyphStart = locaStart + locaLength;
+  if (!LoadGlyphs(header)) {
+    return false;
+  }
+
+  if (header.tablesCount >= 4 && !LoadKerning(glyphStart + glyphLength, header.glyphIdFormat)) {
+    return false;
+  }
+
+  for (uint32_t i = 1; i < glyphCount; i++) {
+    if (dsc.glyph_dsc[i].box_w * dsc.glyph_dsc[i].box_h != 0) {
+      slotSize = std::max(slotSize, BitmapSize(i));
+    }
+  }
+  cacheSlots = std::max<uint8_t>(slots, 1);
+  cacheEntries = new CacheEntry[cacheSlots];
+  cacheBitmaps = new uint8_t[cacheSlots * slotSize];
+  return true;
+}
+
+bool ExternalFont::ReadLabel(uint32_t start, const char* label, uint32_t& length) {
+  char buffer[4];
+  return lv_fs_seek(&file, start) == LV_FS_RES_OK && Read(&length, sizeof(length)) && Read(buffer, sizeof(buffer)) &&
+         std::memcmp(label, buffer, sizeof(buffer)) == 0;
+}
+
+bool ExternalFont::Read(void* buffer, uint32_t size) {
+  uint32_t read = 0;
+  return lv_fs_read(&file, buffer, size, &read) == LV_FS_RES_OK && read == size;
+}
+
+bool ExternalFont::LoadCmaps(uint32_t start, uint32_t& length) {
+  uint32_t count;
+  if (!ReadLabel(start, "cmap", length) || !Read(&count, sizeof(count))) {
+    return false;
+  }
+
+  auto* tables = new CmapTable[count];
+  auto* cmaps = new lv_font_fmt_txt_cmap_t[count] {};
+  dsc.cmaps = cmaps;
+  dsc.cmap_num = count;
+
+  bool success = Read(tables, count * sizeof(CmapTable));
+  for (uint32_t i = 0; success && i < count; i++) {
+    lv_font_fmt_txt_cmap_t& cmap = cmaps[i];
+    cmap.range_start = tables[i].rangeStart;
+    cmap.range_length = tables[i].rangeLength;
+    cmap.glyph_id_start = tables[i].glyphIdStart;
+    cmap.type = static_cast<lv_font_fmt_txt_cmap_type_t>(tables[i].formatType);
+
+    const uint16_t entries = tables[i].dataEntriesCount;
+    success = lv_fs_seek(&file, start + tables[i].dataOffset) == LV_FS_RES_OK;
+    switch (tables[i].formatType) {
+      case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+        auto* ids = new uint8_t[entries];
+        cmap.glyph_id_ofs_list = ids;
+        cmap.list_length = cmap.range_length;
+        success = success && Read(ids, entries);
+      } break;
+      case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+        break;
+      case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+      case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY: {
+        auto* unicodeList = new uint16_t[entries];
+        cmap.unicode_list = unicodeList;
+        cmap.list_length = entries;
+        success = success && Read(unicodeList, entries * sizeof(uint16_t));
+        if (tables[i].formatType == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+          auto* ids = new uint16_t[entries];
+          cmap.glyph_id_ofs_list = ids;
+          success = success && Read(ids, entries * sizeof(uint16_t));
+        }
+      } break;
+      default:
+        success = false;
+        break;
+    }
+  }
+
+  delete[] tables;
+  return success;
+}
+
+bool ExternalFont::LoadLoca(uint32_t start, uint32_t& length, uint8_t format) {
+  if (!ReadLabel(start, "loca", length) || !Read(&glyphCount, sizeof(glyphCount)) || glyphCount == 0) {
+    return false;
+  }
+
+  glyphOffsets = new uint32_t[glyphCount];
+  if (format == 0) {
+    for (uint32_t i = 0; i < glyphCount; i++) {
+      uint16_t offset;
+      if (!Read(&offset, sizeof(offset))) {
+        return false;
+      }
+      glyphOffsets[i] = offset;
+    }
+    return true;
+  }
+  return format == 1 && Read(glyphOffsets, glyphCount * sizeof(uint32_t));
+}
+
+bool ExternalFont::LoadGlyphs(const FontHeader& header) {
+  if (!ReadLabel(glyphStart, "glyf", glyphLength)) {
+    return false;
+  }
+
+  auto* glyphs = new lv_font_fmt_txt_glyph_dsc_t[glyphCount] {};
+  dsc.glyph_dsc = glyphs;
+  glyphHeaderBits = header.advanceWidthBits + 2 * header.xyBits + 2 * header.whBits;
+  const uint8_t headerSize = (glyphHeaderBits + 7) / 8;
+
+  // Glyph 0 is reserved and stays empty
+  for (uint32_t i = 1; i < glyphCount; i++) {
+    uint8_t buffer[maxGlyphHeaderSize];
+    if (lv_fs_seek(&file, glyphStart + glyphOffsets[i]) != LV_FS_RES_OK || !Read(buffer, headerSize)) {
+      return false;
+    }
+
+    BitReader reader(buffer);
+    lv_font_fmt_txt_glyph_dsc_t& glyph = glyphs[i];
+    uint32_t advanceWidth = (header.advanceWidthBits == 0) ? header.defaultAdvanceWidth : reader.Read(header.advanceWidthBits);
+    if (header.advanceWidthFormat == 0) {
+      advanceWidth *= 16;
+    }
+    glyph.adv_w = advanceWidth;
+    glyph.ofs_x = reader.ReadSigned(header.xyBits);
+    glyph.ofs_y = reader.ReadSigned(header.xyBits);
+    glyph.box_w = reader.Read(header.whBits);
+    glyph.box_h = reader.Read(header.whBits);
+  }
+  return true;
+}
+
+bool ExternalFont::LoadKerning(uint32_t start, uint8_t glyphIdFormat) {
+  uint32_t length;
+  uint8_t format[4];
+  if (!ReadLabel(start, "kern", length) || !Read(format, sizeof(format))) {
+    return false;
+  }
+
+  if (format[0] == 0) {
+    uint32_t count;
+    if (!Read(&count, sizeof(count))) {
+      return false;
+    }
+    const uint32_t idsSize = (glyphIdFormat == 0 ? sizeof(uint8_t) : sizeof(uint16_t)) * 2 * count;
+    auto* pairs = new lv_font_fmt_txt_kern_pair_t {};
+    auto* ids = new uint8_t[idsSize];
+    auto* values = new int8_t[count];
+    pairs->glyph_ids = ids;
+    pairs->values = values;
+    pairs->pair_cnt = count;
+    pairs->glyph_ids_size = glyphIdFormat;
+    dsc.kern_dsc = pairs;
+    dsc.kern_classes = 0;
+    return Read(ids, idsSize) && Read(values, count);
+  }
+
+  if (format[0] == 3) {
+    uint16_t mappingLength;
+    uint8_t rows;
+    uint8_t columns;
+    if (!Read(&mappingLength, sizeof(mappingLength)) || !Read(&rows, sizeof(rows)) || !Read(&columns, sizeof(columns))) {
+      return false;
+    }
+    auto* classes = new lv_font_fmt_txt_kern_classes_t {};
+    auto* left = new uint8_t[mappingLength];
+    auto* right = new uint8_t[mappingLength];
+    auto* values = new int8_t[rows * columns];
+    classes->left_class_mapping = left;
+    classes->right_class_mapping = right;
+    classes->class_pair_values = values;
+    classes->left_class_cnt = rows;
+    classes->right_class_cnt = columns;
+    dsc.kern_dsc = classes;
+    dsc.kern_classes = 1;
+    return Read(left, mappingLength) && Read(right, mappingLength) && Read(values, rows * columns);
+  }
+
+  return false;
+}
+
+uint32_t ExternalFont::GlyphId(uint32_t letter) const {
+  if (letter == '\t') {
+    letter = ' ';
+  }
+
+  for (uint16_t i = 0; i < dsc.cmap_num; i++) {
+    const lv_font_fmt_txt_cmap_t& cmap = dsc.cmaps[i];
+    const uint32_t rcp = letter - cmap.range_start;
+    if (rcp > cmap.range_length) {
+      continue;
+    }
+
+    switch (cmap.type) {
+      case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+        return cmap.glyph_id_start + rcp;
+      case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+        return cmap.glyph_id_start + static_cast<const uint8_t*>(cmap.glyph_id_ofs_list)[rcp];
+      case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+      case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+        const uint16_t* end = cmap.unicode_list + cmap.list_length;
+        const uint16_t* it = std::lower_bound(cmap.unicode_list, end, rcp);
+        if (it == end || *it != rcp) {
+          return 0;
+        }
+        const auto index = static_cast<uint32_t>(it - cmap.unicode_list);
+        if (cmap.type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+          return cmap.glyph_id_start + index;
+        }
+        return cmap.glyph_id_start + static_cast<const uint16_t*>(cmap.glyph_id_ofs_list)[index];
+      }
+    }
+    return 0;
+  }
+  return 0;
+}
+
+uint32_t ExternalFont::BitmapSize(uint32_t glyphId) const {
+  const uint32_t next = (glyphId < glyphCount - 1) ? glyphOffsets[glyphId + 1] : glyphLength;
+  return next - glyphOffsets[glyphId] - glyphHeaderBits / 8;
+}
+
+const uint8_t* ExternalFont::GlyphBitmap(uint32_t glyphId) {
+  if (glyphId == 0 || glyphId >= glyphCount) {
+    return nullptr;
+  }
+  if (dsc.glyph_dsc[glyphId].box_w * dsc.glyph_dsc[glyphId].box_h == 0) {
+    return &emptyBitmap;
+  }
+
+  useCounter++;
+  CacheEntry* victim = &cacheEntries[0];
+  for (uint8_t i = 0; i < cacheSlots; i++) {
+    CacheEntry& entry = cacheEntries[i];
+    if (entry.glyphId == glyphId) {
+      entry.lastUse = useCounter;
+      statistics.hits++;
+      return &cacheBitmaps[i * slotSize];
+    }
+    if (entry.glyphId == 0 || (victim->glyphId != 0 && entry.lastUse < victim->lastUse)) {
+      victim = &entry;
+    }
+  }
+
+  statistics.misses++;
+  uint8_t* bitmap = &cacheBitmaps[(victim - cacheEntries) * slotSize];
+  const uint32_t size = BitmapSize(glyphId);
+  victim->glyphId = 0;
+  if (lv_fs_seek(&file, glyphStart + glyphOffsets[glyphId] + glyphHeaderBits / 8) != LV_FS_RES_OK || !Read(bitmap, size)) {
+    return nullptr;
+  }
+
+  // The bitmap starts right after the glyph header, which doesn't have to end on a byte boundary
+  const uint8_t shift = glyphHeaderBits % 8;
+  if (shift != 0) {
+    for (uint32_t i = 0; i < size - 1; i++) {
+      bitmap[i] = static_cast<uint8_t>((bitmap[i] << shift) | (bitmap[i + 1] >> (8 - shift)));
+    }
+    bitmap[size - 1] = static_cast<uint8_t>(bitmap[size - 1] << shift);
+  }
+
+  victim->glyphId = glyphId;
+  victim->lastUse = useCounter;
+  return bitmap;
+}
+
+const uint8_t* ExternalFont::GetGlyphBitmap(const lv_font_t* font, uint32_t letter) {
+  auto* externalFont = static_cast<ExternalFont*>(font->user_data);
+  return externalFont->GlyphBitmap(externalFont->GlyphId(letter));
+}
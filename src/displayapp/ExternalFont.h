@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <lvgl/lvgl.h>
+
+namespace Pinetime {
+  namespace Components {
+    // Font stored in the LVGL binary format (see lv_font_conv) on the external flash.
+    // Unlike lv_font_load(), only the header, the character maps, the kerning table and the
+    // glyph descriptors are kept in RAM. Glyph bitmaps are read from the file when they are
+    // drawn and kept in a small LRU cache, so the file stays open as long as the font is loaded.
+    // Size the cache for the longest label drawn with the font. LVGL draws a label stripe by stripe, and each
+    // stripe draws all the glyphs of the label: with fewer slots than glyphs, every glyph misses the cache.
+    // The bitmaps are read by the display task through the LVGL 'F:' driver, like the other files LVGL loads.
+    // Controllers::FS serializes these reads with the writes of the other tasks.
+    class ExternalFont {
+    public:
+      struct CacheStatistics {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+      };
+
+      // Returns nullptr if the file can't be opened or parsed.
+      // The cache holds up to `cacheSlots` bitmaps, each one the size of the largest glyph of the font.
+      static lv_font_t* Load(const char* path, uint8_t cacheSlots);
+      static void Free(lv_font_t* font);
+      static const CacheStatistics& GetCacheStatistics(const lv_font_t* font);
+
+      ExternalFont(const ExternalFont&) = delete;
+      ExternalFont& operator=(const ExternalFont&) = delete;
+
+    private:
+      struct FontHeader;
+      struct CacheEntry {
+        uint16_t glyphId = 0;
+        uint32_t lastUse = 0;
+      };
+
+      ExternalFont() = default;
+      ~ExternalFont();
+
+      bool Open(const char* path, uint8_t slots);
+      bool ReadLabel(uint32_t start, const char* label, uint32_t& length);
+      bool Read(void* buffer, uint32_t size);
+      bool LoadCmaps(uint32_t start, uint32_t& length);
+      bool LoadLoca(uint32_t start, uint32_t& length, uint8_t format);
+      bool LoadGlyphs(const FontHeader& header);
+      bool LoadKerning(uint32_t start, uint8_t glyphIdFormat);
+
+      uint32_t GlyphId(uint32_t letter) const;
+      const uint8_t* GlyphBitmap(uint32_t glyphId);
+      uint32_t BitmapSize(uint32_t glyphId) const;
+
+      static const uint8_t* GetGlyphBitmap(const lv_font_t* font, uint32_t letter);
+
+      lv_font_t font {};
+      lv_font_fmt_txt_dsc_t dsc {};
+      lv_fs_file_t file {};
+      bool fileOpen = false;
+
+      uint32_t glyphStart = 0;
+      uint32_t glyphLength = 0;
+      uint32_t glyphCount = 0;
+      uint8_t glyphHeaderBits = 0;
+      uint32_t* glyphOffsets = nullptr;
+
+      uint8_t cacheSlots = 0;
+      uint32_t slotSize = 0;
+      uint32_t useCounter = 0;
+      CacheEntry* cacheEntries = nullptr;
+      uint8_t* cacheBitmaps = nullptr;
+      CacheStatistics statistics;
+    };
+  }
+}
@@ -6,6 +6,7 @@
 #include "drivers/St7789.h"
 #include "littlefs/lfs.h"
 #include "components/fs/FS.h"
+#include "utility/Rgb565.h"
 
 using namespace Pinetime::Components;
 
@@ -68,6 +69,16 @@ static void rounder(lv_disp_drv_t* disp_drv, lv_area_t* area) {
   }
 }
 
+// Replaces the callback of the refresh task of the display, so that the invalidated areas are coalesced
+// once per frame, before LVGL joins and redraws them. This can't be done in the rounder: LVGL also calls it
+// on a probe area to size the draw buffer stripes.
+static void refresh_task(lv_task_t* task) {
+  auto* disp = static_cast<lv_disp_t*>(task->user_data);
+  auto* lvgl = static_cast<LittleVgl*>(disp->driver.user_data);
+  lvgl->CoalesceInvalidatedAreas(disp);
+  _lv_disp_refr_task(task);
+}
+
 bool touchpad_read(lv_indev_drv_t* indev_drv, lv_indev_data_t* data) {
   auto* lvgl = static_cast<LittleVgl*>(indev_drv->user_data);
   return lvgl->GetTouchPadInfo(data);
@@ -102,7 +113,8 @@ void LittleVgl::InitDisplay() {
   disp_drv.rounder_cb = rounder;
 
   /*Finally register the driver*/
-  lv_disp_drv_register(&disp_drv);
+  lv_disp_t* disp = lv_disp_drv_register(&disp_drv);
+  lv_task_set_cb(disp->refr_task, refresh_task);
 }
 
 void LittleVgl::InitTouchpad() {
@@ -149,8 +161,41 @@ void LittleVgl::SetFullRefresh(FullRefreshDirections direction) {
   fullRefresh = true;
 }
 
+void LittleVgl::CoalesceInvalidatedAreas(lv_disp_t* disp) {
+  // Scroll animations refresh the whole screen in a specific order, leave them alone
+  if (scrollDirection != FullRefreshDirections::None) {
+    return;
+  }
+
+  // Grow each area over the other invalidated ones when flushing them together is cheaper than flushing them
+  // separately. The areas merged into another one are marked as joined, so LVGL skips them.
+  for (uint32_t i = 0; i < disp->inv_p; i++) {
+    if (disp->inv_area_joined[i] != 0) {
+      continue;
+    }
+    bool grown = true;
+    while (grown) {
+      grown = false;
+      for (uint32_t j = 0; j < disp->inv_p; j++) {
+        if (j == i || disp->inv_area_joined[j] != 0) {
+          continue;
+        }
+        lv_area_t joined;
+        _lv_area_join(&joined, &disp->inv_areas[i], &disp->inv_areas[j]);
+        if (FlushCost(joined) <= FlushCost(disp->inv_areas[i]) + FlushCost(disp->inv_areas[j])) {
+          lv_area_copy(&disp->inv_areas[i], &joined);
+          disp->inv_area_joined[j] = 1;
+          flushStatistics.coalescedAreas++;
+          grown = true;
+        }
+      }
+    }
+  }
+}
+
 void LittleVgl::FlushDisplay(const lv_area_t* area, lv_color_t* color_p) {
   uint16_t y1, y2, width, height = 0;
+  const TickType_t startTick = xTaskGetTickCount();
 
   ulTaskNotifyTake(pdTRUE, 200);
   // Notification is still needed (even if there is a mutex on SPI) because of the DataCommand pin
@@ -214,6 +259,11 @@ void LittleVgl::FlushDisplay(const lv_area_t* area, lv_color_t* color_p) {
     }
   }
 
+#if LV_COLOR_16_SWAP == 0
+  // LVGL renders in native byte order, convert to the order expected by the display
+  Pinetime::Utility::Rgb565::Swap(reinterpret_cast<uint16_t*>(color_p), lv_area_get_size(area));
+#endif
+
   if (y2 < y1) {
     height = totalNbLines - y1;
 
@@ -230,11 +280,67 @@ void LittleVgl::FlushDisplay(const lv_area_t* area, lv_color_t* color_p) {
     lcd.DrawBuffer(area->x1, y1, width, height, reinterpret_cast<const uint8_t*>(color_p), width * height * 2);
   }
 
+  UpdateFlushStatistics(startTick, lv_area_get_size(area) * sizeof(lv_color_t));
+
   // IMPORTANT!!!
   // Inform the graphics library that you are ready with the flushing
   lv_disp_flush_ready(&disp_drv);
 }
 
+void LittleVgl::UpdateFlushStatistics(uint32_t startTick, size_t size) {
+  // A frame spans from the first flush of a refresh to the last one, so the rendering time
+  // LVGL spends between the chunks is accounted for too.
+  if (frameFlushes == 0) {
+    frameStartTick = startTick;
+  }
+  frameFlushes++;
+  frameBytes += size;
+  flushStatistics.flushes++;
+  flushStatistics.bytes += size;
+
+  if (lv_disp_flush_is_last(&disp_drv)) {
+    flushStatistics.frames++;
+    flushStatistics.lastFrameFlushes = frameFlushes;
+    flushStatistics.lastFrameBytes = frameBytes;
+    flushStatistics.lastFrameTicks = xTaskGetTickCount() - frameStartTick;
+    if (flushStatistics.lastFrameTicks > flushStatistics.maxFrameTicks) {
+      flushStatistics.maxFrameTicks = flushStatistics.lastFrameTicks;
+    }
+    frameFlushes = 0;
+    frameBytes = 0;
+  }
+}
+
+void LittleVgl::Pause() {
+  if (paused) {
+    return;
+  }
+  lv_task_t* refreshTask = lv_disp_get_default()->refr_task;
+  lv_task_t* inputTask = lv_indev_get_next(nullptr)->driver.read_task;
+  refreshTaskPriority = static_cast<lv_task_prio_t>(refreshTask->prio);
+  inputTaskPriority = static_cast<lv_task_prio_t>(inputTask->prio);
+  lv_task_set_prio(refreshTask, LV_TASK_PRIO_OFF);
+  lv_task_set_prio(inputTask, LV_TASK_PRIO_OFF);
+  paused = true;
+}
+
+void LittleVgl::Resume() {
+  if (!paused) {
+    return;
+  }
+  lv_task_t* refreshTask = lv_disp_get_default()->refr_task;
+  lv_task_t* inputTask = lv_indev_get_next(nullptr)->driver.read_task;
+  lv_task_set_prio(refreshTask, refreshTaskPriority);
+  lv_task_set_prio(inputTask, inputTaskPriority);
+  lv_task_ready(refreshTask);
+  lv_task_ready(inputTask);
+  paused = false;
+}
+
+bool LittleVgl::IsRefreshPending() const {
+  return lv_disp_get_default()->inv_p != 0;
+}
+
 void LittleVgl::SetNewTouchPoint(int16_t x, int16_t y, bool contact) {
   if (contact) {
     if (!isCancelled) {
@@ -12,6 +12,18 @@ namespace Pinetime {
     class LittleVgl {
     public:
       enum class FullRefreshDirections { None, Up, Down, Left, Right, LeftAnim, RightAnim };
+
+      struct FlushStatistics {
+        uint32_t frames = 0;
+        uint32_t flushes = 0;
+        uint32_t bytes = 0;
+        uint16_t lastFrameFlushes = 0;
+        uint32_t lastFrameBytes = 0;
+        uint32_t lastFrameTicks = 0;
+        uint32_t maxFrameTicks = 0;
+        uint32_t coalescedAreas = 0;
+      };
+
       LittleVgl(Pinetime::Drivers::St7789& lcd, Pinetime::Controllers::FS& filesystem);
 
       LittleVgl(const LittleVgl&) = delete;
@@ -24,9 +36,24 @@ namespace Pinetime {
       void FlushDisplay(const lv_area_t* area, lv_color_t* color_p);
       bool GetTouchPadInfo(lv_indev_data_t* ptr);
       void SetFullRefresh(FullRefreshDirections direction);
+      void CoalesceInvalidatedAreas(lv_disp_t* disp);
       void SetNewTouchPoint(int16_t x, int16_t y, bool contact);
       void CancelTap();
 
+      // Stops the periodic display refresh and touch input tasks of LVGL, so that lv_task_handler() doesn't
+      // wake the display task up every LV_DISP_DEF_REFR_PERIOD while nothing changes on the screen.
+      void Pause();
+      void Resume();
+      bool IsRefreshPending() const;
+
+      bool IsPaused() const {
+        return paused;
+      }
+
+      const FlushStatistics& GetFlushStatistics() const {
+        return flushStatistics;
+      }
+
       bool GetFullRefresh() {
         bool returnValue = fullRefresh;
         if (fullRefresh) {
@@ -39,6 +66,7 @@ namespace Pinetime {
       void InitDisplay();
       void InitTouchpad();
       void InitFileSystem();
+      void UpdateFlushStatistics(uint32_t startTick, size_t size);
 
       Pinetime::Drivers::St7789& lcd;
       Pinetime::Controllers::FS& filesystem;
@@ -58,6 +86,14 @@ namespace Pinetime {
         return LV_VER_RES_MAX - nbWriteLines;
       }
 
+      // Fixed cost of flushing one more area, expressed in bytes of pixel data: the CASET/RASET/RAMWR
+      // sequence is sent as 11 single-byte SPI transfers and LVGL walks the object tree for each area.
+      static constexpr uint32_t areaFlushOverhead = 512;
+
+      static uint32_t FlushCost(const lv_area_t& area) {
+        return areaFlushOverhead + lv_area_get_size(&area) * sizeof(lv_color_t);
+      }
+
       FullRefreshDirections scrollDirection = FullRefreshDirections::None;
       uint16_t writeOffset = 0;
       uint16_t scrollOffset = 0;
@@ -65,6 +101,15 @@ namespace Pinetime {
       lv_point_t touchPoint = {};
       bool tapped = false;
       bool isCancelled = false;
+
+      bool paused = false;
+      lv_task_prio_t refreshTaskPriority = LV_TASK_PRIO_MID;
+      lv_task_prio_t inputTaskPriority = LV_TASK_PRIO_HIGH;
+
+      FlushStatistics flushStatistics;
+      uint32_t frameStartTick = 0;
+      uint16_t frameFlushes = 0;
+      uint32_t frameBytes = 0;
     };
   }
 }
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "displayapp/screens/Screen.h"
+
+namespace Pinetime {
+  namespace Applications {
+    // Statically reserved storage for the screen of the current app or watch face.
+    // DisplayApp destroys the current screen before it creates the next one, so all of them are constructed
+    // in the same storage instead of being allocated from the heap at each transition.
+    // Only one screen can live in the arena: the sub-screens (the pages of a ScreenList for example) are
+    // still allocated from the heap.
+    // The storage is defined in DisplayApp.cpp, sized for the largest screen built into the firmware: the built-in
+    // screens and the ScreenType of the AppTraits and WatchFaceTraits of the selected apps and watch faces.
+    class ScreenArena {
+    public:
+      // Destroys a screen created by Create()
+      struct Deleter {
+        void operator()(Screens::Screen* screen) const {
+          screen->~Screen();
+        }
+      };
+
+      template <typename T, typename... Args>
+      static T* Create(Args&&... args) {
+        static_assert(std::is_base_of_v<Screens::Screen, T>);
+        static_assert(alignof(T) <= alignof(std::max_align_t));
+        return new (storage) T(std::forward<Args>(args)...);
+      }
+
+    private:
+      static std::byte storage[];
+    };
+
+    using ScreenPtr = std::unique_ptr<Screens::Screen, ScreenArena::Deleter>;
+  }
+}
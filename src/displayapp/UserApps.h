@@ -1,4 +1,6 @@
 #pragma once
+#include <algorithm>
+#include <array>
 #include "displayapp/apps/Apps.h"
 #include "Controllers.h"
 
@@ -21,40 +23,77 @@ namespace Pinetime {
       class Screen;
     }
 
-    struct AppDescription {
-      Apps app;
-      const char* icon;
-      Screens::Screen* (*create)(AppControllers& controllers);
-    };
+    // The create functions construct the screen in the ScreenArena: destroy it with ScreenArena::Deleter
+    using CreateScreen = Screens::Screen* (*)(AppControllers& controllers);
 
     struct WatchFaceDescription {
       WatchFace watchFace;
       const char* name;
-      Screens::Screen* (*create)(AppControllers& controllers);
+      CreateScreen create;
       bool (*isAvailable)(Controllers::FS& fileSystem);
     };
 
-    template <Apps t>
-    consteval AppDescription CreateAppDescription() {
-      return {AppTraits<t>::app, AppTraits<t>::icon, &AppTraits<t>::Create};
-    }
-
     template <WatchFace t>
     consteval WatchFaceDescription CreateWatchFaceDescription() {
       return {WatchFaceTraits<t>::watchFace, WatchFaceTraits<t>::name, &WatchFaceTraits<t>::Create, &WatchFaceTraits<t>::IsAvailable};
     }
 
+    template <template <WatchFace...> typename T, WatchFace... ts>
+    consteval std::array<WatchFaceDescription, sizeof...(ts)> CreateWatchFaceDescriptions(T<ts...>) {
+      return {CreateWatchFaceDescription<ts>()...};
+    }
+
+    // Tiles of the launcher, in the order of the app list
+    template <template <Apps...> typename T, Apps... ts>
+    consteval std::array<Screens::Tile::Applications, sizeof...(ts)> CreateApplicationTiles(T<ts...>) {
+      return {Screens::Tile::Applications {AppTraits<ts>::icon, AppTraits<ts>::app, true}...};
+    }
+
+    // Create functions indexed by the value of the enum, nullptr for the ones that aren't built into the firmware
     template <template <Apps...> typename T, Apps... ts>
-    consteval std::array<AppDescription, sizeof...(ts)> CreateAppDescriptions(T<ts...>) {
-      return {CreateAppDescription<ts>()...};
+    consteval auto CreateAppDispatchTable(T<ts...>) {
+      std::array<CreateScreen, std::max({size_t {0}, (static_cast<size_t>(ts) + 1)...})> table {};
+      ((table[static_cast<size_t>(ts)] = &AppTraits<ts>::Create), ...);
+      return table;
     }
 
     template <template <WatchFace...> typename T, WatchFace... ts>
-    consteval std::array<WatchFaceDescription, sizeof...(ts)> CreateWatchFaceDescriptions(T<ts...>) {
-      return {CreateWatchFaceDescription<ts>()...};
+    consteval auto CreateWatchFaceDispatchTable(T<ts...>) {
+      std::array<CreateScreen, std::max({size_t {0}, (static_cast<size_t>(ts) + 1)...})> table {};
+      ((table[static_cast<size_t>(ts)] = &WatchFaceTraits<ts>::Create), ...);
+      return table;
+    }
+
+    // Size of the largest screen of the list, the ScreenArena is sized from it
+    template <template <Apps...> typename T, Apps... ts>
+    consteval size_t LargestAppScreen(T<ts...>) {
+      return std::max({size_t {0}, sizeof(typename AppTraits<ts>::ScreenType)...});
+    }
+
+    template <template <WatchFace...> typename T, WatchFace... ts>
+    consteval size_t LargestWatchFaceScreen(T<ts...>) {
+      return std::max({size_t {0}, sizeof(typename WatchFaceTraits<ts>::ScreenType)...});
     }
 
-    constexpr auto userApps = CreateAppDescriptions(UserAppTypes {});
     constexpr auto userWatchFaces = CreateWatchFaceDescriptions(UserWatchFaceTypes {});
+    constexpr auto userAppTiles = CreateApplicationTiles(UserAppTypes {});
+    constexpr auto userAppDispatchTable = CreateAppDispatchTable(UserAppTypes {});
+    constexpr auto userWatchFaceDispatchTable = CreateWatchFaceDispatchTable(UserWatchFaceTypes {});
+    constexpr size_t largestUserScreen = std::max(LargestAppScreen(UserAppTypes {}), LargestWatchFaceScreen(UserWatchFaceTypes {}));
+
+    // Returns nullptr if the app isn't built into the firmware
+    constexpr CreateScreen GetUserApp(Apps app) {
+      const auto index = static_cast<size_t>(app);
+      return index < userAppDispatchTable.size() ? userAppDispatchTable[index] : nullptr;
+    }
+
+    // Returns the first watch face of the list if the watch face isn't built into the firmware
+    constexpr CreateScreen GetUserWatchFace(WatchFace watchFace) {
+      const auto index = static_cast<size_t>(watchFace);
+      if (index < userWatchFaceDispatchTable.size() && userWatchFaceDispatchTable[index] != nullptr) {
+        return userWatchFaceDispatchTable[index];
+      }
+      return userWatchFaces[0].create;
+    }
   }
 }
@@ -20,6 +20,7 @@
 #include "displayapp/apps/Apps.h"
 #include "components/settings/Settings.h"
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "displayapp/widgets/Counter.h"
 #include "displayapp/Controllers.h"
 #include "Symbols.h"
@@ -70,12 +71,13 @@ namespace Pinetime {
     struct AppTraits<Apps::Alarm> {
       static constexpr Apps app = Apps::Alarm;
       static constexpr const char* icon = Screens::Symbols::clock;
+      using ScreenType = Screens::Alarm;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Alarm(controllers.alarmController,
-                                  controllers.settingsController.GetClockType(),
-                                  *controllers.systemTask,
-                                  controllers.motorController);
+        return ScreenArena::Create<Screens::Alarm>(controllers.alarmController,
+                                                   controllers.settingsController.GetClockType(),
+                                                   *controllers.systemTask,
+                                                   controllers.motorController);
       };
     };
   }
@@ -2,6 +2,7 @@
 
 #include "displayapp/apps/Apps.h"
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "displayapp/widgets/Counter.h"
 #include "displayapp/Controllers.h"
 #include "Symbols.h"
@@ -52,9 +53,12 @@ namespace Pinetime {
     struct AppTraits<Apps::Dice> {
       static constexpr Apps app = Apps::Dice;
       static constexpr const char* icon = Screens::Symbols::dice;
+      using ScreenType = Screens::Dice;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Dice(controllers.motionController, controllers.motorController, controllers.settingsController);
+        return ScreenArena::Create<Screens::Dice>(controllers.motionController,
+                                                  controllers.motorController,
+                                                  controllers.settingsController);
       };
     };
   }
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <chrono>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "systemtask/SystemTask.h"
 #include "Symbols.h"
 #include <lvgl/src/lv_core/lv_style.h>
@@ -43,9 +44,10 @@ namespace Pinetime {
     struct AppTraits<Apps::HeartRate> {
       static constexpr Apps app = Apps::HeartRate;
       static constexpr const char* icon = Screens::Symbols::heartBeat;
+      using ScreenType = Screens::HeartRate;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::HeartRate(controllers.heartRateController, *controllers.systemTask);
+        return ScreenArena::Create<Screens::HeartRate>(controllers.heartRateController, *controllers.systemTask);
       };
     };
   }
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <algorithm> // std::fill
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/motor/MotorController.h"
 #include "Symbols.h"
 #include "displayapp/apps/Apps.h"
@@ -43,9 +44,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Paint> {
       static constexpr Apps app = Apps::Paint;
       static constexpr const char* icon = Screens::Symbols::paintbrush;
+      using ScreenType = Screens::InfiniPaint;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::InfiniPaint(controllers.lvgl, controllers.motorController);
+        return ScreenArena::Create<Screens::InfiniPaint>(controllers.lvgl, controllers.motorController);
       };
     };
   }
@@ -3,6 +3,7 @@
 #include "systemtask/SystemTask.h"
 #include "components/motor/MotorController.h"
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "Symbols.h"
 
 namespace Pinetime {
@@ -42,9 +43,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Metronome> {
       static constexpr Apps app = Apps::Metronome;
       static constexpr const char* icon = Screens::Symbols::drum;
+      using ScreenType = Screens::Metronome;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Metronome(controllers.motorController, *controllers.systemTask);
+        return ScreenArena::Create<Screens::Metronome>(controllers.motorController, *controllers.systemTask);
       };
     };
   }
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <chrono>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include <lvgl/src/lv_core/lv_style.h>
 #include <lvgl/src/lv_core/lv_obj.h>
 #include <components/motion/MotionController.h>
@@ -37,9 +38,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Motion> {
       static constexpr Apps app = Apps::Motion;
       static constexpr const char* icon = "M";
+      using ScreenType = Screens::Motion;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Motion(controllers.motionController);
+        return ScreenArena::Create<Screens::Motion>(controllers.motionController);
       };
     };
   }
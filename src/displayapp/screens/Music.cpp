@@ -150,18 +150,14 @@ Music::~Music() {
 }
 
 void Music::Refresh() {
-  if (artist != musicService.getArtist()) {
-    artist = musicService.getArtist();
-    lv_label_set_text(txtArtist, artist.data());
+  artistVersion = musicService.getArtist().Version();
+  if (artistVersion.IsUpdated()) {
+    lv_label_set_text(txtArtist, musicService.getArtist().CStr());
   }
 
-  if (track != musicService.getTrack()) {
-    track = musicService.getTrack();
-    lv_label_set_text(txtTrack, track.data());
-  }
-
-  if (album != musicService.getAlbum()) {
-    album = musicService.getAlbum();
+  trackVersion = musicService.getTrack().Version();
+  if (trackVersion.IsUpdated()) {
+    lv_label_set_text(txtTrack, musicService.getTrack().CStr());
   }
 
   if (playing != musicService.isPlaying()) {
@@ -19,8 +19,10 @@
 
 #include <FreeRTOS.h>
 #include <lvgl/src/lv_core/lv_obj.h>
-#include <string>
+#include <cstdint>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
+#include "utility/DirtyValue.h"
 #include "displayapp/apps/Apps.h"
 #include "displayapp/Controllers.h"
 #include "Symbols.h"
@@ -67,9 +69,8 @@ namespace Pinetime {
 
         Pinetime::Controllers::MusicService& musicService;
 
-        std::string artist;
-        std::string album;
-        std::string track;
+        Utility::DirtyValue<uint32_t> artistVersion {};
+        Utility::DirtyValue<uint32_t> trackVersion {};
 
         /** Total length in seconds */
         int totalLength = 0;
@@ -90,9 +91,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Music> {
       static constexpr Apps app = Apps::Music;
       static constexpr const char* icon = Screens::Symbols::music;
+      using ScreenType = Screens::Music;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Music(*controllers.musicService);
+        return ScreenArena::Create<Screens::Music>(*controllers.musicService);
       };
     };
   }
@@ -17,6 +17,7 @@
 */
 #include "displayapp/screens/Navigation.h"
 #include <cstdint>
+#include <string_view>
 #include "displayapp/DisplayApp.h"
 #include "components/ble/NavigationService.h"
 #include "displayapp/InfiniTimeTheme.h"
@@ -176,7 +177,7 @@ namespace {
     return {iconsFile1, static_cast<int16_t>(iconHeight * (index - maxIconsPerFile))};
   }
 
-  Icon GetIcon(const std::string& icon) {
+  Icon GetIcon(std::string_view icon) {
     for (const auto& iter : iconMap) {
       if (iter.first == icon) {
         return GetIcon(iter.second);
@@ -238,23 +239,23 @@ Navigation::~Navigation() {
 }
 
 void Navigation::Refresh() {
-  if (flag != navService.getFlag()) {
-    flag = navService.getFlag();
-    const auto& image = GetIcon(flag);
+  flagVersion = navService.getFlag().Version();
+  if (flagVersion.IsUpdated()) {
+    const auto& image = GetIcon(navService.getFlag().View());
     lv_img_set_src(imgFlag, image.fileName);
     lv_obj_set_style_local_image_recolor_opa(imgFlag, LV_IMG_PART_MAIN, LV_STATE_DEFAULT, LV_OPA_COVER);
     lv_obj_set_style_local_image_recolor(imgFlag, LV_IMG_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_CYAN);
     lv_img_set_offset_y(imgFlag, image.offset);
   }
 
-  if (narrative != navService.getNarrative()) {
-    narrative = navService.getNarrative();
-    lv_label_set_text(txtNarrative, narrative.data());
+  narrativeVersion = navService.getNarrative().Version();
+  if (narrativeVersion.IsUpdated()) {
+    lv_label_set_text(txtNarrative, navService.getNarrative().CStr());
   }
 
-  if (manDist != navService.getManDist()) {
-    manDist = navService.getManDist();
-    lv_label_set_text(txtManDist, manDist.data());
+  manDistVersion = navService.getManDist().Version();
+  if (manDistVersion.IsUpdated()) {
+    lv_label_set_text(txtManDist, navService.getManDist().CStr());
   }
 
   if (progress != navService.getProgress()) {
@@ -19,8 +19,10 @@
 
 #include <FreeRTOS.h>
 #include <lvgl/src/lv_core/lv_obj.h>
-#include <string>
+#include <cstdint>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
+#include "utility/DirtyValue.h"
 #include <array>
 #include "displayapp/apps/Apps.h"
 #include "displayapp/Controllers.h"
@@ -50,9 +52,9 @@ namespace Pinetime {
 
         Pinetime::Controllers::NavigationService& navService;
 
-        std::string flag;
-        std::string narrative;
-        std::string manDist;
+        Utility::DirtyValue<uint32_t> flagVersion {};
+        Utility::DirtyValue<uint32_t> narrativeVersion {};
+        Utility::DirtyValue<uint32_t> manDistVersion {};
         int progress = 0;
 
         lv_task_t* taskRefresh;
@@ -63,9 +65,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Navigation> {
       static constexpr Apps app = Apps::Navigation;
       static constexpr const char* icon = Screens::Symbols::map;
+      using ScreenType = Screens::Navigation;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Navigation(*controllers.navigationService);
+        return ScreenArena::Create<Screens::Navigation>(*controllers.navigationService);
       };
     };
   }
@@ -3,6 +3,7 @@
 #include <lvgl/lvgl.h>
 #include <cstdint>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "displayapp/apps/Apps.h"
 #include "displayapp/Controllers.h"
 #include "Symbols.h"
@@ -53,9 +54,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Paddle> {
       static constexpr Apps app = Apps::Paddle;
       static constexpr const char* icon = Screens::Symbols::paddle;
+      using ScreenType = Screens::Paddle;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Paddle(controllers.lvgl);
+        return ScreenArena::Create<Screens::Paddle>(controllers.lvgl);
       };
     };
   }
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include "displayapp/TouchEvents.h"
+#include "components/events/ChangeNotifier.h"
 #include <lvgl/lvgl.h>
 
 namespace Pinetime {
@@ -25,6 +26,17 @@ namespace Pinetime {
           return running;
         }
 
+        /** @return the topics of Controllers::ChangeNotifier shown by this screen. Screens that subscribe to
+         * topics don't need a refresh task: DisplayApp calls OnChanges() when one of them is published. */
+        virtual Controllers::ChangeNotifier::Topics Subscriptions() const {
+          return 0;
+        }
+
+        // Called with the published topics the screen subscribed to. Refreshes the whole screen by default.
+        virtual void OnChanges(Controllers::ChangeNotifier::Topics /*topics*/) {
+          Refresh();
+        }
+
         /** @return false if the button hasn't been handled by the app, true if it has been handled */
         virtual bool OnButtonPushed() {
           return false;
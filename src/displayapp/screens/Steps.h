@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <lvgl/lvgl.h>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include <components/motion/MotionController.h>
 #include "displayapp/apps/Apps.h"
 #include "displayapp/Controllers.h"
@@ -47,9 +48,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Steps> {
       static constexpr Apps app = Apps::Steps;
       static constexpr const char* icon = Screens::Symbols::shoe;
+      using ScreenType = Screens::Steps;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::Steps(controllers.motionController, controllers.settingsController);
+        return ScreenArena::Create<Screens::Steps>(controllers.motionController, controllers.settingsController);
       };
     };
   }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include <lvgl/lvgl.h>
 
 #include <FreeRTOS.h>
@@ -64,9 +65,10 @@ namespace Pinetime {
     struct AppTraits<Apps::StopWatch> {
       static constexpr Apps app = Apps::StopWatch;
       static constexpr const char* icon = Screens::Symbols::stopWatch;
+      using ScreenType = Screens::StopWatch;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::StopWatch(*controllers.systemTask);
+        return ScreenArena::Create<Screens::StopWatch>(*controllers.systemTask);
       };
     };
   }
@@ -1,9 +1,12 @@
 #include <FreeRTOS.h>
 #include <algorithm>
 #include <task.h>
+#include <cstdio>
+#include "FreeRTOS/heap_4_infinitime.h"
 #include "displayapp/screens/SystemInfo.h"
 #include <lvgl/lvgl.h>
 #include "displayapp/DisplayApp.h"
+#include "displayapp/LittleVgl.h"
 #include "displayapp/screens/Label.h"
 #include "Version.h"
 #include "BootloaderVersion.h"
@@ -38,7 +41,8 @@ SystemInfo::SystemInfo(Pinetime::Applications::DisplayApp* app,
                        const Pinetime::Controllers::Ble& bleController,
                        const Pinetime::Drivers::Watchdog& watchdog,
                        Pinetime::Controllers::MotionController& motionController,
-                       const Pinetime::Drivers::Cst816S& touchPanel)
+                       const Pinetime::Drivers::Cst816S& touchPanel,
+                       const Pinetime::Components::LittleVgl& lvgl)
   : app {app},
     dateTimeController {dateTimeController},
     batteryController {batteryController},
@@ -47,6 +51,7 @@ SystemInfo::SystemInfo(Pinetime::Applications::DisplayApp* app,
     watchdog {watchdog},
     motionController {motionController},
     touchPanel {touchPanel},
+    lvgl {lvgl},
     screens {app,
              0,
              {[this]() -> std::unique_ptr<Screen> {
@@ -63,6 +68,12 @@ SystemInfo::SystemInfo(Pinetime::Applications::DisplayApp* app,
               },
               [this]() -> std::unique_ptr<Screen> {
                 return CreateScreen5();
+              },
+              [this]() -> std::unique_ptr<Screen> {
+                return CreateScreen6();
+              },
+              [this]() -> std::unique_ptr<Screen> {
+                return CreateScreen7();
               }},
              Screens::ScreenListModes::UpDown} {
 }
@@ -95,7 +106,7 @@ std::unique_ptr<Screen> SystemInfo::CreateScreen1() {
                         BootloaderVersion::VersionString());
   lv_label_set_align(label, LV_LABEL_ALIGN_CENTER);
   lv_obj_align(label, lv_scr_act(), LV_ALIGN_CENTER, 0, 0);
-  return std::make_unique<Screens::Label>(0, 5, label);
+  return std::make_unique<Screens::Label>(0, 7, label);
 }
 
 std::unique_ptr<Screen> SystemInfo::CreateScreen2() {
@@ -174,7 +185,7 @@ std::unique_ptr<Screen> SystemInfo::CreateScreen2() {
                         touchPanel.GetFwVersion(),
                         TARGET_DEVICE_NAME);
   lv_obj_align(label, lv_scr_act(), LV_ALIGN_CENTER, 0, 0);
-  return std::make_unique<Screens::Label>(1, 5, label);
+  return std::make_unique<Screens::Label>(1, 7, label);
 }
 
 extern int mallocFailedCount;
@@ -207,14 +218,53 @@ std::unique_ptr<Screen> SystemInfo::CreateScreen3() {
                         mallocFailedCount,
                         stackOverflowCount);
   lv_obj_align(label, lv_scr_act(), LV_ALIGN_CENTER, 0, 0);
-  return std::make_unique<Screens::Label>(2, 5, label);
+  return std::make_unique<Screens::Label>(2, 7, label);
+}
+
+std::unique_ptr<Screen> SystemInfo::CreateScreen4() {
+  HeapReport_t report;
+  vPortGetHeapReport(&report);
+
+  lv_obj_t* label = lv_label_create(lv_scr_act(), nullptr);
+  lv_label_set_recolor(label, true);
+  lv_label_set_text_fmt(label,
+                        "#808080 Heap blocks#\n"
+                        " #808080 Largest free# %d\n"
+                        " #808080 Free blocks# %d\n"
+                        " #808080 Allocated# %d\n"
+                        "#808080 Free block sizes#\n"
+                        " #808080 <64# %d #808080 <256# %d\n"
+                        " #808080 <1K# %d #808080 <4K# %d\n"
+                        " #808080 4K+# %d",
+                        report.xSizeOfLargestFreeBlockInBytes,
+                        report.xNumberOfFreeBlocks,
+                        report.xNumberOfSuccessfulAllocations - report.xNumberOfSuccessfulFrees,
+                        report.xFreeBlockHistogram[0],
+                        report.xFreeBlockHistogram[1],
+                        report.xFreeBlockHistogram[2],
+                        report.xFreeBlockHistogram[3],
+                        report.xFreeBlockHistogram[4]);
+
+#if configHEAP_INSTRUMENTATION == 1
+  // The call sites holding the most memory, resolve them with addr2line
+  HeapCallSite_t callSites[2];
+  auto nbCallSites = uxPortGetHeapCallSites(callSites, 2);
+  for (size_t i = 0; i < nbCallSites; i++) {
+    char line[24];
+    snprintf(line, sizeof(line), "\n %08lx %d", reinterpret_cast<unsigned long>(callSites[i].pvCallSite), callSites[i].xLiveBytes);
+    lv_label_ins_text(label, LV_LABEL_POS_LAST, line);
+  }
+#endif
+
+  lv_obj_align(label, lv_scr_act(), LV_ALIGN_CENTER, 0, 0);
+  return std::make_unique<Screens::Label>(3, 7, label);
 }
 
 bool SystemInfo::sortById(const TaskStatus_t& lhs, const TaskStatus_t& rhs) {
   return lhs.xTaskNumber < rhs.xTaskNumber;
 }
 
-std::unique_ptr<Screen> SystemInfo::CreateScreen4() {
+std::unique_ptr<Screen> SystemInfo::CreateScreen5() {
   static constexpr uint8_t maxTaskCount = 9;
   TaskStatus_t tasksStatus[maxTaskCount];
 
@@ -268,10 +318,37 @@ std::unique_ptr<Screen> SystemInfo::CreateScreen4() {
     }
     lv_table_set_cell_value(infoTask, i + 1, 3, buffer);
   }
-  return std::make_unique<Screens::Label>(3, 5, infoTask);
+  return std::make_unique<Screens::Label>(4, 7, infoTask);
 }
 
-std::unique_ptr<Screen> SystemInfo::CreateScreen5() {
+std::unique_ptr<Screen> SystemInfo::CreateScreen6() {
+  const auto& stats = lvgl.GetFlushStatistics();
+
+  lv_obj_t* label = lv_label_create(lv_scr_act(), nullptr);
+  lv_label_set_recolor(label, true);
+  lv_label_set_text_fmt(label,
+                        "#FFFF00 Display#\n\n"
+                        "#808080 Frames# %lu\n"
+                        "#808080 Flushes# %lu\n"
+                        "#808080 Bytes# %lu\n"
+                        "#808080 Merged# %lu\n\n"
+                        "#808080 Last frame#\n"
+                        " %u flushes\n"
+                        " %lu B / %lu ms\n"
+                        "#808080 Max frame# %lu ms",
+                        stats.frames,
+                        stats.flushes,
+                        stats.bytes,
+                        stats.coalescedAreas,
+                        stats.lastFrameFlushes,
+                        stats.lastFrameBytes,
+                        stats.lastFrameTicks * 1000 / configTICK_RATE_HZ,
+                        stats.maxFrameTicks * 1000 / configTICK_RATE_HZ);
+  lv_obj_align(label, lv_scr_act(), LV_ALIGN_CENTER, 0, 0);
+  return std::make_unique<Screens::Label>(5, 7, label);
+}
+
+std::unique_ptr<Screen> SystemInfo::CreateScreen7() {
   lv_obj_t* label = lv_label_create(lv_scr_act(), nullptr);
   lv_label_set_recolor(label, true);
   lv_label_set_text_static(label,
@@ -285,5 +362,5 @@ std::unique_ptr<Screen> SystemInfo::CreateScreen5() {
                            "#FFFF00 InfiniTime#");
   lv_label_set_align(label, LV_LABEL_ALIGN_CENTER);
   lv_obj_align(label, lv_scr_act(), LV_ALIGN_CENTER, 0, 0);
-  return std::make_unique<Screens::Label>(4, 5, label);
+  return std::make_unique<Screens::Label>(6, 7, label);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/datetime/DateTimeController.h"
 #include "systemtask/SystemTask.h"
 #include "displayapp/LittleVgl.h"
@@ -50,9 +51,10 @@ namespace Pinetime::Applications {
   struct AppTraits<Apps::Timer> {
     static constexpr Apps app = Apps::Timer;
     static constexpr const char* icon = Screens::Symbols::hourGlass;
+    using ScreenType = Screens::Timer;
 
     static Screens::Screen* Create(AppControllers& controllers) {
-      return new Screens::Timer(controllers.timer);
+      return ScreenArena::Create<Screens::Timer>(controllers.timer);
     };
   };
 }
@@ -2,6 +2,7 @@
 
 #include "displayapp/apps/Apps.h"
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "displayapp/Controllers.h"
 
 namespace Pinetime {
@@ -41,9 +42,10 @@ namespace Pinetime {
     struct AppTraits<Apps::Twos> {
       static constexpr Apps app = Apps::Twos;
       static constexpr const char* icon = "2";
+      using ScreenType = Screens::Twos;
 
       static Screens::Screen* Create(AppControllers& /*controllers*/) {
-        return new Screens::Twos();
+        return ScreenArena::Create<Screens::Twos>();
       };
     };
   }
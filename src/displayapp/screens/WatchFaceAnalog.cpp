@@ -154,14 +154,10 @@ WatchFaceAnalog::WatchFaceAnalog(Controllers::DateTime& dateTimeController,
   lv_style_set_line_rounded(&hour_line_style_trace, LV_STATE_DEFAULT, false);
   lv_obj_add_style(hour_body_trace, LV_LINE_PART_MAIN, &hour_line_style_trace);
 
-  taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
-
   Refresh();
 }
 
 WatchFaceAnalog::~WatchFaceAnalog() {
-  lv_task_del(taskRefresh);
-
   lv_style_reset(&hour_line_style);
   lv_style_reset(&hour_line_style_trace);
   lv_style_reset(&minute_line_style);
@@ -171,6 +167,11 @@ WatchFaceAnalog::~WatchFaceAnalog() {
   lv_obj_clean(lv_scr_act());
 }
 
+Pinetime::Controllers::ChangeNotifier::Topics WatchFaceAnalog::Subscriptions() const {
+  using Topic = Controllers::ChangeNotifier::Topic;
+  return Controllers::ChangeNotifier::Mask(Topic::Second, Topic::Battery, Topic::Ble, Topic::Notifications);
+}
+
 void WatchFaceAnalog::UpdateClock() {
   uint8_t hour = dateTimeController.Hours();
   uint8_t minute = dateTimeController.Minutes();
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <memory>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/datetime/DateTimeController.h"
 #include "components/battery/BatteryController.h"
 #include "components/ble/BleController.h"
@@ -34,6 +35,7 @@ namespace Pinetime {
         ~WatchFaceAnalog() override;
 
         void Refresh() override;
+        Controllers::ChangeNotifier::Topics Subscriptions() const override;
 
       private:
         uint8_t sHour, sMinute, sSecond;
@@ -85,7 +87,6 @@ namespace Pinetime {
         void UpdateClock();
         void SetBatteryIcon();
 
-        lv_task_t* taskRefresh;
       };
     }
 
@@ -93,13 +94,14 @@ namespace Pinetime {
     struct WatchFaceTraits<WatchFace::Analog> {
       static constexpr WatchFace watchFace = WatchFace::Analog;
       static constexpr const char* name = "Analog face";
+      using ScreenType = Screens::WatchFaceAnalog;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::WatchFaceAnalog(controllers.dateTimeController,
-                                            controllers.batteryController,
-                                            controllers.bleController,
-                                            controllers.notificationManager,
-                                            controllers.settingsController);
+        return ScreenArena::Create<Screens::WatchFaceAnalog>(controllers.dateTimeController,
+                                                             controllers.batteryController,
+                                                             controllers.bleController,
+                                                             controllers.notificationManager,
+                                                             controllers.settingsController);
       };
 
       static bool IsAvailable(Pinetime::Controllers::FS& /*filesystem*/) {
@@ -2,6 +2,7 @@
 
 #include <lvgl/lvgl.h>
 #include <cstdio>
+#include "displayapp/ExternalFont.h"
 #include "displayapp/screens/BatteryIcon.h"
 #include "displayapp/screens/BleIcon.h"
 #include "displayapp/screens/NotificationIcon.h"
@@ -35,17 +36,17 @@ WatchFaceCasioStyleG7710::WatchFaceCasioStyleG7710(Controllers::DateTime& dateTi
   lfs_file f = {};
   if (filesystem.FileOpen(&f, "/fonts/lv_font_dots_40.bin", LFS_O_RDONLY) >= 0) {
     filesystem.FileClose(&f);
-    font_dot40 = lv_font_load("F:/fonts/lv_font_dots_40.bin");
+    font_dot40 = Components::ExternalFont::Load("F:/fonts/lv_font_dots_40.bin", dot40CacheSlots);
   }
 
   if (filesystem.FileOpen(&f, "/fonts/7segments_40.bin", LFS_O_RDONLY) >= 0) {
     filesystem.FileClose(&f);
-    font_segment40 = lv_font_load("F:/fonts/7segments_40.bin");
+    font_segment40 = Components::ExternalFont::Load("F:/fonts/7segments_40.bin", segment40CacheSlots);
   }
 
   if (filesystem.FileOpen(&f, "/fonts/7segments_115.bin", LFS_O_RDONLY) >= 0) {
     filesystem.FileClose(&f);
-    font_segment115 = lv_font_load("F:/fonts/7segments_115.bin");
+    font_segment115 = Components::ExternalFont::Load("F:/fonts/7segments_115.bin", segment115CacheSlots);
   }
 
   label_battery_value = lv_label_create(lv_scr_act(), nullptr);
@@ -168,31 +169,34 @@ WatchFaceCasioStyleG7710::WatchFaceCasioStyleG7710(Controllers::DateTime& dateTi
   lv_label_set_text_static(stepIcon, Symbols::shoe);
   lv_obj_align(stepIcon, stepValue, LV_ALIGN_OUT_LEFT_MID, -5, 0);
 
-  taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
   Refresh();
 }
 
 WatchFaceCasioStyleG7710::~WatchFaceCasioStyleG7710() {
-  lv_task_del(taskRefresh);
 
   lv_style_reset(&style_line);
   lv_style_reset(&style_border);
 
   if (font_dot40 != nullptr) {
-    lv_font_free(font_dot40);
+    Components::ExternalFont::Free(font_dot40);
   }
 
   if (font_segment40 != nullptr) {
-    lv_font_free(font_segment40);
+    Components::ExternalFont::Free(font_segment40);
   }
 
   if (font_segment115 != nullptr) {
-    lv_font_free(font_segment115);
+    Components::ExternalFont::Free(font_segment115);
   }
 
   lv_obj_clean(lv_scr_act());
 }
 
+Pinetime::Controllers::ChangeNotifier::Topics WatchFaceCasioStyleG7710::Subscriptions() const {
+  using Topic = Controllers::ChangeNotifier::Topic;
+  return Controllers::ChangeNotifier::Mask(Topic::Minute, Topic::Battery, Topic::Ble, Topic::Notifications, Topic::HeartRate, Topic::Steps);
+}
+
 void WatchFaceCasioStyleG7710::Refresh() {
   powerPresent = batteryController.IsPowerPresent();
   if (powerPresent.IsUpdated()) {
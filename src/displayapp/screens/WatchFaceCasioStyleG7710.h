@@ -7,6 +7,7 @@
 #include <memory>
 #include <displayapp/Controllers.h>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/datetime/DateTimeController.h"
 #include "components/ble/BleController.h"
 #include "utility/DirtyValue.h"
@@ -38,6 +39,7 @@ namespace Pinetime {
         ~WatchFaceCasioStyleG7710() override;
 
         void Refresh() override;
+        Controllers::ChangeNotifier::Topics Subscriptions() const override;
 
         static bool IsAvailable(Pinetime::Controllers::FS& filesystem);
 
@@ -96,10 +98,18 @@ namespace Pinetime {
         Controllers::HeartRateController& heartRateController;
         Controllers::MotionController& motionController;
 
-        lv_task_t* taskRefresh;
         lv_font_t* font_dot40 = nullptr;
         lv_font_t* font_segment40 = nullptr;
         lv_font_t* font_segment115 = nullptr;
+
+        // Glyph cache slots of the external fonts. A slot holds the largest glyph of the font, so each cache holds the
+        // glyphs of the longest label drawn with the font rather than every glyph the labels can show.
+        // label_day_of_week: 3 letters, label_week_number: "WK" and 2 digits
+        static constexpr uint8_t dot40CacheSlots = 4;
+        // label_day_of_year: "%3d-%3d", label_date: "%3d-%2d"
+        static constexpr uint8_t segment40CacheSlots = 7;
+        // label_time: "%02d:%02d"
+        static constexpr uint8_t segment115CacheSlots = 5;
       };
     }
 
@@ -107,16 +117,17 @@ namespace Pinetime {
     struct WatchFaceTraits<WatchFace::CasioStyleG7710> {
       static constexpr WatchFace watchFace = WatchFace::CasioStyleG7710;
       static constexpr const char* name = "Casio G7710";
+      using ScreenType = Screens::WatchFaceCasioStyleG7710;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::WatchFaceCasioStyleG7710(controllers.dateTimeController,
-                                                     controllers.batteryController,
-                                                     controllers.bleController,
-                                                     controllers.notificationManager,
-                                                     controllers.settingsController,
-                                                     controllers.heartRateController,
-                                                     controllers.motionController,
-                                                     controllers.filesystem);
+        return ScreenArena::Create<Screens::WatchFaceCasioStyleG7710>(controllers.dateTimeController,
+                                                                      controllers.batteryController,
+                                                                      controllers.bleController,
+                                                                      controllers.notificationManager,
+                                                                      controllers.settingsController,
+                                                                      controllers.heartRateController,
+                                                                      controllers.motionController,
+                                                                      controllers.filesystem);
       };
 
       static bool IsAvailable(Pinetime::Controllers::FS& filesystem) {
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <memory>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/datetime/DateTimeController.h"
 #include "components/ble/SimpleWeatherService.h"
 #include "components/ble/BleController.h"
@@ -38,6 +39,7 @@ namespace Pinetime {
         ~WatchFaceDigital() override;
 
         void Refresh() override;
+        Controllers::ChangeNotifier::Topics Subscriptions() const override;
 
       private:
         uint8_t displayedHour = -1;
@@ -75,7 +77,6 @@ namespace Pinetime {
         Controllers::MotionController& motionController;
         Controllers::SimpleWeatherService& weatherService;
 
-        lv_task_t* taskRefresh;
         Widgets::StatusIcons statusIcons;
       };
     }
@@ -84,16 +85,17 @@ namespace Pinetime {
     struct WatchFaceTraits<WatchFace::Digital> {
       static constexpr WatchFace watchFace = WatchFace::Digital;
       static constexpr const char* name = "Digital face";
+      using ScreenType = Screens::WatchFaceDigital;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::WatchFaceDigital(controllers.dateTimeController,
-                                             controllers.batteryController,
-                                             controllers.bleController,
-                                             controllers.notificationManager,
-                                             controllers.settingsController,
-                                             controllers.heartRateController,
-                                             controllers.motionController,
-                                             *controllers.weatherController);
+        return ScreenArena::Create<Screens::WatchFaceDigital>(controllers.dateTimeController,
+                                                              controllers.batteryController,
+                                                              controllers.bleController,
+                                                              controllers.notificationManager,
+                                                              controllers.settingsController,
+                                                              controllers.heartRateController,
+                                                              controllers.motionController,
+                                                              *controllers.weatherController);
       };
 
       static bool IsAvailable(Pinetime::Controllers::FS& /*filesystem*/) {
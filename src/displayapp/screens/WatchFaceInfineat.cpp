@@ -2,6 +2,7 @@
 
 #include <lvgl/lvgl.h>
 #include <cstdio>
+#include "displayapp/ExternalFont.h"
 #include "displayapp/screens/Symbols.h"
 #include "displayapp/screens/BleIcon.h"
 #include "components/settings/Settings.h"
@@ -136,12 +137,12 @@ WatchFaceInfineat::WatchFaceInfineat(Controllers::DateTime& dateTimeController,
   lfs_file f = {};
   if (filesystem.FileOpen(&f, "/fonts/teko.bin", LFS_O_RDONLY) >= 0) {
     filesystem.FileClose(&f);
-    font_teko = lv_font_load("F:/fonts/teko.bin");
+    font_teko = Components::ExternalFont::Load("F:/fonts/teko.bin", tekoCacheSlots);
   }
 
   if (filesystem.FileOpen(&f, "/fonts/bebas.bin", LFS_O_RDONLY) >= 0) {
     filesystem.FileClose(&f);
-    font_bebas = lv_font_load("F:/fonts/bebas.bin");
+    font_bebas = Components::ExternalFont::Load("F:/fonts/bebas.bin", bebasCacheSlots);
   }
 
   // Side Cover
@@ -296,18 +297,19 @@ WatchFaceInfineat::WatchFaceInfineat(Controllers::DateTime& dateTimeController,
   lv_label_set_text_static(labelBtnSettings, Symbols::settings);
   lv_obj_set_hidden(btnSettings, true);
 
-  taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
   Refresh();
 }
 
 WatchFaceInfineat::~WatchFaceInfineat() {
-  lv_task_del(taskRefresh);
+  if (taskRefresh != nullptr) {
+    lv_task_del(taskRefresh);
+  }
 
   if (font_bebas != nullptr) {
-    lv_font_free(font_bebas);
+    Components::ExternalFont::Free(font_bebas);
   }
   if (font_teko != nullptr) {
-    lv_font_free(font_teko);
+    Components::ExternalFont::Free(font_teko);
   }
 
   lv_obj_clean(lv_scr_act());
@@ -317,6 +319,7 @@ bool WatchFaceInfineat::OnTouchEvent(Pinetime::Applications::TouchEvents event)
   if ((event == Pinetime::Applications::TouchEvents::LongTap) && lv_obj_get_hidden(btnSettings)) {
     lv_obj_set_hidden(btnSettings, false);
     savedTick = lv_tick_get();
+    UpdateRefreshTask();
     return true;
   }
   // Prevent screen from sleeping when double tapping with settings on
@@ -464,6 +467,25 @@ void WatchFaceInfineat::Refresh() {
       savedTick = 0;
     }
   }
+
+  UpdateRefreshTask();
+}
+
+Pinetime::Controllers::ChangeNotifier::Topics WatchFaceInfineat::Subscriptions() const {
+  using Topic = Controllers::ChangeNotifier::Topic;
+  return Controllers::ChangeNotifier::Mask(Topic::Minute, Topic::Battery, Topic::Ble, Topic::Notifications, Topic::Steps);
+}
+
+void WatchFaceInfineat::UpdateRefreshTask() {
+  // The charging animation and the timeout of the settings button need a periodic refresh,
+  // everything else is refreshed when the controllers publish a change
+  const bool needed = isCharging.Get() || !lv_obj_get_hidden(btnSettings);
+  if (needed && taskRefresh == nullptr) {
+    taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
+  } else if (!needed && taskRefresh != nullptr) {
+    lv_task_del(taskRefresh);
+    taskRefresh = nullptr;
+  }
 }
 
 void WatchFaceInfineat::SetBatteryLevel(uint8_t batteryPercent) {
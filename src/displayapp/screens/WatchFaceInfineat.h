@@ -6,6 +6,7 @@
 #include <memory>
 #include <displayapp/Controllers.h>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/datetime/DateTimeController.h"
 #include "utility/DirtyValue.h"
 #include "displayapp/apps/Apps.h"
@@ -41,6 +42,7 @@ namespace Pinetime {
         void CloseMenu();
 
         void Refresh() override;
+        Controllers::ChangeNotifier::Topics Subscriptions() const override;
 
         static bool IsAvailable(Pinetime::Controllers::FS& filesystem);
 
@@ -94,10 +96,18 @@ namespace Pinetime {
 
         void SetBatteryLevel(uint8_t batteryPercent);
         void ToggleBatteryIndicatorColor(bool showSideCover);
+        void UpdateRefreshTask();
 
-        lv_task_t* taskRefresh;
+        lv_task_t* taskRefresh = nullptr;
         lv_font_t* font_teko = nullptr;
         lv_font_t* font_bebas = nullptr;
+
+        // Glyph cache slots of the external fonts. A slot holds the largest glyph of the font, so each cache holds the
+        // glyphs of the longest label drawn with the font rather than every glyph the labels can show.
+        // labelHour and labelMinutes: 2 digits each
+        static constexpr uint8_t bebasCacheSlots = 2;
+        // labelTimeAmPm: "AM" or "PM", labelDate: day name, space and 2 digits, stepValue: up to 6 digits
+        static constexpr uint8_t tekoCacheSlots = 6;
       };
     }
 
@@ -105,15 +115,16 @@ namespace Pinetime {
     struct WatchFaceTraits<WatchFace::Infineat> {
       static constexpr WatchFace watchFace = WatchFace::Infineat;
       static constexpr const char* name = "Infineat face";
+      using ScreenType = Screens::WatchFaceInfineat;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::WatchFaceInfineat(controllers.dateTimeController,
-                                              controllers.batteryController,
-                                              controllers.bleController,
-                                              controllers.notificationManager,
-                                              controllers.settingsController,
-                                              controllers.motionController,
-                                              controllers.filesystem);
+        return ScreenArena::Create<Screens::WatchFaceInfineat>(controllers.dateTimeController,
+                                                               controllers.batteryController,
+                                                               controllers.bleController,
+                                                               controllers.notificationManager,
+                                                               controllers.settingsController,
+                                                               controllers.motionController,
+                                                               controllers.filesystem);
       };
 
       static bool IsAvailable(Pinetime::Controllers::FS& filesystem) {
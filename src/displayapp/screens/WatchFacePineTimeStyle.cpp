@@ -394,12 +394,13 @@ WatchFacePineTimeStyle::WatchFacePineTimeStyle(Controllers::DateTime& dateTimeCo
   lv_label_set_text_static(lblSetOpts, Symbols::settings);
   lv_obj_set_hidden(btnSetOpts, true);
 
-  taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
   Refresh();
 }
 
 WatchFacePineTimeStyle::~WatchFacePineTimeStyle() {
-  lv_task_del(taskRefresh);
+  if (taskRefresh != nullptr) {
+    lv_task_del(taskRefresh);
+  }
   lv_obj_clean(lv_scr_act());
 }
 
@@ -408,6 +409,7 @@ bool WatchFacePineTimeStyle::OnTouchEvent(Pinetime::Applications::TouchEvents ev
     lv_obj_set_hidden(btnSetColor, false);
     lv_obj_set_hidden(btnSetOpts, false);
     savedTick = lv_tick_get();
+    UpdateRefreshTask();
     return true;
   }
   if ((event == Pinetime::Applications::TouchEvents::DoubleTap) && (lv_obj_get_hidden(btnClose) == false)) {
@@ -565,6 +567,25 @@ void WatchFacePineTimeStyle::Refresh() {
       savedTick = 0;
     }
   }
+
+  UpdateRefreshTask();
+}
+
+Pinetime::Controllers::ChangeNotifier::Topics WatchFacePineTimeStyle::Subscriptions() const {
+  using Topic = Controllers::ChangeNotifier::Topic;
+  // The seconds are only shown with the half gauge, but the gauge style can be changed without reloading the screen
+  return Controllers::ChangeNotifier::Mask(Topic::Second, Topic::Battery, Topic::Ble, Topic::Notifications, Topic::Steps, Topic::Weather);
+}
+
+void WatchFacePineTimeStyle::UpdateRefreshTask() {
+  // Only the timeout of the settings buttons needs a periodic refresh
+  const bool needed = !lv_obj_get_hidden(btnSetColor);
+  if (needed && taskRefresh == nullptr) {
+    taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
+  } else if (!needed && taskRefresh != nullptr) {
+    lv_task_del(taskRefresh);
+    taskRefresh = nullptr;
+  }
 }
 
 void WatchFacePineTimeStyle::UpdateSelected(lv_obj_t* object, lv_event_t event) {
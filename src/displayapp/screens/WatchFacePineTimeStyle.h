@@ -6,6 +6,7 @@
 #include <memory>
 #include <displayapp/Controllers.h>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "displayapp/screens/BatteryIcon.h"
 #include "displayapp/Colors.h"
 #include "components/datetime/DateTimeController.h"
@@ -40,6 +41,7 @@ namespace Pinetime {
         bool OnButtonPushed() override;
 
         void Refresh() override;
+        Controllers::ChangeNotifier::Topics Subscriptions() const override;
 
         void UpdateSelected(lv_obj_t* object, lv_event_t event);
 
@@ -116,8 +118,9 @@ namespace Pinetime {
 
         void SetBatteryIcon();
         void CloseMenu();
+        void UpdateRefreshTask();
 
-        lv_task_t* taskRefresh;
+        lv_task_t* taskRefresh = nullptr;
       };
     }
 
@@ -125,15 +128,16 @@ namespace Pinetime {
     struct WatchFaceTraits<WatchFace::PineTimeStyle> {
       static constexpr WatchFace watchFace = WatchFace::PineTimeStyle;
       static constexpr const char* name = "PineTimeStyle";
+      using ScreenType = Screens::WatchFacePineTimeStyle;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::WatchFacePineTimeStyle(controllers.dateTimeController,
-                                                   controllers.batteryController,
-                                                   controllers.bleController,
-                                                   controllers.notificationManager,
-                                                   controllers.settingsController,
-                                                   controllers.motionController,
-                                                   *controllers.weatherController);
+        return ScreenArena::Create<Screens::WatchFacePineTimeStyle>(controllers.dateTimeController,
+                                                                    controllers.batteryController,
+                                                                    controllers.bleController,
+                                                                    controllers.notificationManager,
+                                                                    controllers.settingsController,
+                                                                    controllers.motionController,
+                                                                    *controllers.weatherController);
       };
 
       static bool IsAvailable(Pinetime::Controllers::FS& /*filesystem*/) {
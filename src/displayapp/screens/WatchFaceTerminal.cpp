@@ -62,15 +62,18 @@ WatchFaceTerminal::WatchFaceTerminal(Controllers::DateTime& dateTimeController,
   lv_label_set_recolor(stepValue, true);
   lv_obj_align(stepValue, lv_scr_act(), LV_ALIGN_IN_LEFT_MID, 0, 0);
 
-  taskRefresh = lv_task_create(RefreshTaskCallback, LV_DISP_DEF_REFR_PERIOD, LV_TASK_PRIO_MID, this);
   Refresh();
 }
 
 WatchFaceTerminal::~WatchFaceTerminal() {
-  lv_task_del(taskRefresh);
   lv_obj_clean(lv_scr_act());
 }
 
+Pinetime::Controllers::ChangeNotifier::Topics WatchFaceTerminal::Subscriptions() const {
+  using Topic = Controllers::ChangeNotifier::Topic;
+  return Controllers::ChangeNotifier::Mask(Topic::Second, Topic::Battery, Topic::Ble, Topic::Notifications, Topic::HeartRate, Topic::Steps);
+}
+
 void WatchFaceTerminal::Refresh() {
   powerPresent = batteryController.IsPowerPresent();
   batteryPercentRemaining = batteryController.PercentRemaining();
@@ -6,6 +6,7 @@
 #include <memory>
 #include <displayapp/Controllers.h>
 #include "displayapp/screens/Screen.h"
+#include "displayapp/ScreenArena.h"
 #include "components/datetime/DateTimeController.h"
 #include "utility/DirtyValue.h"
 
@@ -34,6 +35,7 @@ namespace Pinetime {
         ~WatchFaceTerminal() override;
 
         void Refresh() override;
+        Controllers::ChangeNotifier::Topics Subscriptions() const override;
 
       private:
         Utility::DirtyValue<int> batteryPercentRemaining {};
@@ -66,7 +68,6 @@ namespace Pinetime {
         Controllers::HeartRateController& heartRateController;
         Controllers::MotionController& motionController;
 
-        lv_task_t* taskRefresh;
       };
     }
 
@@ -74,15 +75,16 @@ namespace Pinetime {
     struct WatchFaceTraits<WatchFace::Terminal> {
       static constexpr WatchFace watchFace = WatchFace::Terminal;
       static constexpr const char* name = "Terminal";
+      using ScreenType = Screens::WatchFaceTerminal;
 
       static Screens::Screen* Create(AppControllers& controllers) {
-        return new Screens::WatchFaceTerminal(controllers.dateTimeController,
-                                              controllers.batteryController,
-                                              controllers.bleController,
-                                              controllers.notificationManager,
-                                              controllers.settingsController,
-                                              controllers.heartRateController,
-                                              controllers.motionController);
+        return ScreenArena::Create<Screens::WatchFaceTerminal>(controllers.dateTimeController,
+                                                               controllers.batteryController,
+                                                               controllers.bleController,
+                                                               controllers.notificationManager,
+                                                               controllers.settingsController,
+                                                               controllers.heartRateController,
+                                                               controllers.motionController);
       };
 
       static bool IsAvailable(Pinetime::Controllers::FS& /*filesystem*/) {
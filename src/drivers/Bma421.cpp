@@ -22,6 +22,8 @@ namespace {
   void user_delay(uint32_t period_us, void* /*intf_ptr*/) {
     nrf_delay_us(period_us);
   }
+
+  constexpr uint8_t fifoFlushCommand = 0xB0;
 }
 
 Bma421::Bma421(TwiMaster& twiMaster, uint8_t twiAddress) : twiMaster {twiMaster}, deviceAddress {twiAddress} {
@@ -83,6 +85,24 @@ void Bma421::Init() {
   if (ret != BMA4_OK)
     return;
 
+  // Headerless FIFO containing only filtered accelerometer frames
+  ret = bma4_set_fifo_config(BMA4_FIFO_HEADER, 0, &bma);
+  if (ret != BMA4_OK)
+    return;
+
+  ret = bma4_set_fifo_config(BMA4_FIFO_ACCEL, 1, &bma);
+  if (ret != BMA4_OK)
+    return;
+
+  uint8_t fifoDown = BMA4_FIFO_FILTER_ACCEL_MSK | (fifoDownsampling << BMA4_FIFO_DOWN_ACCEL_POS);
+  ret = bma4_write_regs(BMA4_FIFO_DOWN_ADDR, &fifoDown, 1, &bma);
+  if (ret != BMA4_OK)
+    return;
+
+  ret = bma4_set_command_register(fifoFlushCommand, &bma);
+  if (ret != BMA4_OK)
+    return;
+
   isOk = true;
 }
 
@@ -100,29 +120,56 @@ void Bma421::Write(uint8_t registerAddress, const uint8_t* data, size_t size) {
 }
 
 Bma421::Values Bma421::Process() {
+  Values values {};
   if (not isOk)
-    return {};
-  struct bma4_accel data;
-  bma4_read_accel_xyz(&data, &bma);
-
-  uint32_t steps = 0;
-  bma423_step_counter_output(&steps, &bma);
+    return values;
+
+  uint8_t length[2];
+  Read(BMA4_FIFO_LENGTH_0_ADDR, length, sizeof(length));
+  const uint16_t nbFrames = ((length[1] & 0x3fu) << 8 | length[0]) / fifoFrameSize;
+  if (nbFrames == 0)
+    return values;
+
+  if (nbFrames > maxSamples) {
+    // The samples are too old to be useful (the caller didn't read them for a while), drop them
+    bma4_set_command_register(fifoFlushCommand, &bma);
+    values.samples[0] = ReadCurrentSample();
+    values.nbSamples = 1;
+  } else {
+    uint8_t data[maxSamples * fifoFrameSize];
+    Read(BMA4_FIFO_DATA_ADDR, data, nbFrames * fifoFrameSize);
+    for (uint8_t i = 0; i < nbFrames; i++) {
+      const uint8_t* frame = &data[i * fifoFrameSize];
+      // 12 bits values, left-aligned. X and Y axis are swapped because of the way the sensor is mounted in the PineTime
+      values.samples[i].x = static_cast<int16_t>(frame[3] << 8 | frame[2]) / 0x10;
+      values.samples[i].y = static_cast<int16_t>(frame[1] << 8 | frame[0]) / 0x10;
+      values.samples[i].z = static_cast<int16_t>(frame[5] << 8 | frame[4]) / 0x10;
+    }
+    values.nbSamples = nbFrames;
+  }
 
-  int32_t temperature;
-  bma4_get_temperature(&temperature, BMA4_DEG, &bma);
-  temperature = temperature / 1000;
+  values.steps = ReadStepCount();
+  return values;
+}
 
-  uint8_t activity = 0;
-  bma423_activity_output(&activity, &bma);
+Bma421::Sample Bma421::ReadCurrentSample() {
+  struct bma4_accel data;
+  bma4_read_accel_xyz(&data, &bma);
 
   // X and Y axis are swapped because of the way the sensor is mounted in the PineTime
-  return {steps, data.y, data.x, data.z};
+  return {data.y, data.x, data.z};
 }
 
 bool Bma421::IsOk() const {
   return isOk;
 }
 
+uint32_t Bma421::ReadStepCount() {
+  uint32_t steps = 0;
+  bma423_step_counter_output(&steps, &bma);
+  return steps;
+}
+
 void Bma421::ResetStepCounter() {
   bma423_reset_step_counter(&bma);
 }
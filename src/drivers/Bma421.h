@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <drivers/Bma421_C/bma4_defs.h>
 
 namespace Pinetime {
@@ -9,13 +10,21 @@ namespace Pinetime {
     public:
       enum class DeviceTypes : uint8_t { Unknown, BMA421, BMA425 };
 
-      struct Values {
-        uint32_t steps;
+      struct Sample {
         int16_t x;
         int16_t y;
         int16_t z;
       };
 
+      // Largest number of samples returned by a single call to Process()
+      static constexpr uint8_t maxSamples = 8;
+
+      struct Values {
+        uint32_t steps;
+        uint8_t nbSamples;
+        std::array<Sample, maxSamples> samples; // oldest first
+      };
+
       Bma421(TwiMaster& twiMaster, uint8_t twiAddress);
       Bma421(const Bma421&) = delete;
       Bma421& operator=(const Bma421&) = delete;
@@ -26,7 +35,10 @@ namespace Pinetime {
       /// Init() method to allow the caller to uninit and then reinit the TWI device after the softreset.
       void SoftReset();
       void Init();
+      /// Returns the samples queued in the FIFO since the previous call, read in a single burst.
+      /// nbSamples is 0 when no new sample is available, in which case steps isn't updated either.
       Values Process();
+      uint32_t ReadStepCount();
       void ResetStepCounter();
 
       void Read(uint8_t registerAddress, uint8_t* buffer, size_t size);
@@ -37,6 +49,12 @@ namespace Pinetime {
 
     private:
       void Reset();
+      Sample ReadCurrentSample();
+
+      // Accelerometer samples are queued in the FIFO at 100Hz / 2^fifoDownsampling = 12.5Hz,
+      // close to the rate at which SystemTask used to poll the data registers.
+      static constexpr uint8_t fifoDownsampling = 3;
+      static constexpr uint8_t fifoFrameSize = 6;
 
       TwiMaster& twiMaster;
       uint8_t deviceAddress = 0x18;
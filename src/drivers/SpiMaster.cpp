@@ -127,14 +127,17 @@ void SpiMaster::OnEndEvent() {
     return;
   }
 
-  auto s = currentBufferSize;
-  if (s > 0) {
-    auto currentSize = std::min((size_t) 255, s);
-    PrepareTx(currentBufferAddr, currentSize);
-    currentBufferAddr = currentBufferAddr + currentSize;
-    currentBufferSize = currentBufferSize - currentSize;
+  if (chainedChunks > 0) {
+    // The chunks of the chain are started by PPI: only the END of the last one needs to be handled here.
+    NRF_TIMER1->TASKS_CAPTURE[1] = 1;
+    if (NRF_TIMER1->CC[1] < chainedChunks) {
+      return;
+    }
+    DisableChain();
+  }
 
-    spiBaseAddress->TASKS_START = 1;
+  if (currentBufferSize > 0) {
+    StartNextTransfer();
   } else {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
     if (taskToNotify != nullptr) {
@@ -150,6 +153,55 @@ void SpiMaster::OnEndEvent() {
   }
 }
 
+void SpiMaster::StartNextTransfer() {
+  auto nbChunks = currentBufferSize / maxChunkSize;
+  if (nbChunks > 1) {
+    // Send all the full-size chunks in a row: EasyDMA ArrayList advances TXD.PTR after each chunk and
+    // PPI restarts the transfer on END, so the bus doesn't wait for the ISR between chunks.
+    PrepareTx(currentBufferAddr, maxChunkSize);
+    spiBaseAddress->TXD.LIST = SPIM_TXD_LIST_LIST_ArrayList << SPIM_TXD_LIST_LIST_Pos;
+    EnableChain(nbChunks);
+    currentBufferAddr = currentBufferAddr + (nbChunks * maxChunkSize);
+    currentBufferSize = currentBufferSize - (nbChunks * maxChunkSize);
+  } else {
+    auto currentSize = std::min(maxChunkSize, (size_t) currentBufferSize);
+    PrepareTx(currentBufferAddr, currentSize);
+    currentBufferAddr = currentBufferAddr + currentSize;
+    currentBufferSize = currentBufferSize - currentSize;
+  }
+
+  spiBaseAddress->TASKS_START = 1;
+}
+
+void SpiMaster::EnableChain(size_t nbChunks) {
+  chainedChunks = nbChunks;
+
+  // TIMER1 counts the END events. When the last chunk is started, the COMPARE event disables the
+  // channel that restarts the transfer so that the chain stops by itself.
+  NRF_TIMER1->TASKS_STOP = 1;
+  NRF_TIMER1->MODE = TIMER_MODE_MODE_LowPowerCounter << TIMER_MODE_MODE_Pos;
+  NRF_TIMER1->BITMODE = TIMER_BITMODE_BITMODE_16Bit << TIMER_BITMODE_BITMODE_Pos;
+  NRF_TIMER1->TASKS_CLEAR = 1;
+  NRF_TIMER1->CC[0] = nbChunks - 1;
+  NRF_TIMER1->EVENTS_COMPARE[0] = 0;
+  NRF_TIMER1->TASKS_START = 1;
+
+  NRF_PPI->CH[chainPpiChannel].EEP = (uint32_t) &spiBaseAddress->EVENTS_END;
+  NRF_PPI->CH[chainPpiChannel].TEP = (uint32_t) &spiBaseAddress->TASKS_START;
+  NRF_PPI->CH[countPpiChannel].EEP = (uint32_t) &spiBaseAddress->EVENTS_END;
+  NRF_PPI->CH[countPpiChannel].TEP = (uint32_t) &NRF_TIMER1->TASKS_COUNT;
+  NRF_PPI->CH[stopPpiChannel].EEP = (uint32_t) &NRF_TIMER1->EVENTS_COMPARE[0];
+  NRF_PPI->CH[stopPpiChannel].TEP = (uint32_t) &NRF_PPI->TASKS_CHG[chainPpiGroup].DIS;
+  NRF_PPI->CHG[chainPpiGroup] = 1U << chainPpiChannel;
+  NRF_PPI->CHENSET = (1U << chainPpiChannel) | (1U << countPpiChannel) | (1U << stopPpiChannel);
+}
+
+void SpiMaster::DisableChain() {
+  NRF_PPI->CHENCLR = (1U << chainPpiChannel) | (1U << countPpiChannel) | (1U << stopPpiChannel);
+  NRF_TIMER1->TASKS_STOP = 1;
+  chainedChunks = 0;
+}
+
 void SpiMaster::OnStartedEvent() {
 }
 
@@ -192,12 +244,7 @@ bool SpiMaster::Write(uint8_t pinCsn, const uint8_t* data, size_t size) {
 
   currentBufferAddr = (uint32_t) data;
   currentBufferSize = size;
-
-  auto currentSize = std::min((size_t) 255, (size_t) currentBufferSize);
-  PrepareTx(currentBufferAddr, currentSize);
-  currentBufferSize = currentBufferSize - currentSize;
-  currentBufferAddr = currentBufferAddr + currentSize;
-  spiBaseAddress->TASKS_START = 1;
+  StartNextTransfer();
 
   if (size == 1) {
     while (spiBaseAddress->EVENTS_END == 0)
@@ -283,11 +330,18 @@ bool SpiMaster::WriteCmdAndBuffer(uint8_t pinCsn, const uint8_t* cmd, size_t cmd
   while (spiBaseAddress->EVENTS_END == 0)
     ;
 
-  PrepareTx((uint32_t) data, dataSize);
-  spiBaseAddress->TASKS_START = 1;
+  // The chip select stays low between the chunks, so the device receives longer data (a full flash page)
+  // as part of the same command
+  while (dataSize > 0) {
+    const size_t chunkSize = std::min(maxChunkSize, dataSize);
+    PrepareTx((uint32_t) data, chunkSize);
+    spiBaseAddress->TASKS_START = 1;
 
-  while (spiBaseAddress->EVENTS_END == 0)
-    ;
+    while (spiBaseAddress->EVENTS_END == 0)
+      ;
+    data += chunkSize;
+    dataSize -= chunkSize;
+  }
   nrf_gpio_pin_set(this->pinCsn);
 
   xSemaphoreGive(mutex);
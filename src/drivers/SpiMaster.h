@@ -47,6 +47,18 @@ namespace Pinetime {
       void DisableWorkaroundForFtpan58(NRF_SPIM_Type* spim, uint32_t ppi_channel, uint32_t gpiote_channel);
       void PrepareTx(const volatile uint32_t bufferAddress, const volatile size_t size);
       void PrepareRx(const volatile uint32_t bufferAddress, const volatile size_t size);
+      void StartNextTransfer();
+      void EnableChain(size_t nbChunks);
+      void DisableChain();
+
+      // EasyDMA can transfer at most 255 bytes at once (MAXCNT is 8 bits wide on the nRF52832)
+      static constexpr size_t maxChunkSize = 255;
+      // PPI resources used to chain full-size chunks without CPU intervention.
+      // Channel 0 and GPIOTE channel 0 are used by the FTPAN58 workaround, channels 4, 5 and 17-31 by NimBLE.
+      static constexpr uint8_t chainPpiChannel = 1;
+      static constexpr uint8_t countPpiChannel = 2;
+      static constexpr uint8_t stopPpiChannel = 3;
+      static constexpr uint8_t chainPpiGroup = 0;
 
       NRF_SPIM_Type* spiBaseAddress;
       uint8_t pinCsn;
@@ -56,6 +68,7 @@ namespace Pinetime {
 
       volatile uint32_t currentBufferAddr = 0;
       volatile size_t currentBufferSize = 0;
+      volatile size_t chainedChunks = 0;
       volatile TaskHandle_t taskToNotify;
       SemaphoreHandle_t mutex = nullptr;
     };
@@ -1,4 +1,7 @@
 #include "drivers/SpiNorFlash.h"
+#include <algorithm>
+#include <FreeRTOS.h>
+#include <task.h>
 #include <hal/nrf_gpio.h>
 #include <libraries/delay/nrf_delay.h>
 #include <libraries/log/nrf_log.h>
@@ -71,12 +74,33 @@ uint8_t SpiNorFlash::ReadConfigurationRegister() {
 }
 
 void SpiNorFlash::Read(uint32_t address, uint8_t* buffer, size_t size) {
-  static constexpr uint8_t cmdSize = 4;
-  uint8_t cmd[cmdSize] = {static_cast<uint8_t>(Commands::Read),
-                          static_cast<uint8_t>(address >> 16U),
-                          static_cast<uint8_t>(address >> 8U),
-                          static_cast<uint8_t>(address)};
-  spi.Read(reinterpret_cast<uint8_t*>(&cmd), cmdSize, buffer, size);
+  // Fast Read is followed by a dummy byte, and isn't limited to the lower clock rate of the Read command
+  static constexpr uint8_t cmdSize = 5;
+
+  while (size > 0) {
+    const size_t toRead = std::min(size, maxTransferSize);
+    uint8_t cmd[cmdSize] = {static_cast<uint8_t>(Commands::FastRead),
+                            static_cast<uint8_t>(address >> 16U),
+                            static_cast<uint8_t>(address >> 8U),
+                            static_cast<uint8_t>(address),
+                            0};
+    spi.Read(reinterpret_cast<uint8_t*>(&cmd), cmdSize, buffer, toRead);
+
+    address += toRead;
+    buffer += toRead;
+    size -= toRead;
+  }
+}
+
+void SpiNorFlash::WaitWhileBusy(uint32_t typicalTimeMs, uint32_t maxPollIntervalMs) {
+  vTaskDelay(pdMS_TO_TICKS(typicalTimeMs));
+
+  TickType_t pollInterval = 1;
+  const TickType_t maxPollInterval = std::max<TickType_t>(pdMS_TO_TICKS(maxPollIntervalMs), 1);
+  while (WriteInProgress()) {
+    vTaskDelay(pollInterval);
+    pollInterval = std::min<TickType_t>(pollInterval * 2, maxPollInterval);
+  }
 }
 
 void SpiNorFlash::WriteEnable() {
@@ -97,8 +121,7 @@ void SpiNorFlash::SectorErase(uint32_t sectorAddress) {
 
   spi.Read(reinterpret_cast<uint8_t*>(&cmd), cmdSize, nullptr, 0);
 
-  while (WriteInProgress())
-    vTaskDelay(1);
+  WaitWhileBusy(sectorEraseTimeMs, sectorEraseMaxPollMs);
 }
 
 uint8_t SpiNorFlash::ReadSecurityRegister() {
@@ -124,7 +147,7 @@ void SpiNorFlash::Write(uint32_t address, const uint8_t* buffer, size_t size) {
   const uint8_t* b = buffer;
   while (len > 0) {
     uint32_t pageLimit = (addr & ~(pageSize - 1u)) + pageSize;
-    uint32_t toWrite = pageLimit - addr > len ? len : pageLimit - addr;
+    uint32_t toWrite = std::min<size_t>(pageLimit - addr, len);
 
     uint8_t cmd[cmdSize] = {static_cast<uint8_t>(Commands::PageProgram),
                             static_cast<uint8_t>(addr >> 16U),
@@ -137,8 +160,7 @@ void SpiNorFlash::Write(uint32_t address, const uint8_t* buffer, size_t size) {
 
     spi.WriteCmdAndBuffer(cmd, cmdSize, b, toWrite);
 
-    while (WriteInProgress())
-      vTaskDelay(1);
+    WaitWhileBusy(pageProgramTimeMs, pageProgramMaxPollMs);
 
     addr += toWrite;
     b += toWrite;
@@ -43,6 +43,7 @@ namespace Pinetime {
       enum class Commands : uint8_t {
         PageProgram = 0x02,
         Read = 0x03,
+        FastRead = 0x0B,
         ReadStatusRegister = 0x05,
         WriteEnable = 0x06,
         ReadConfigurationRegister = 0x15,
@@ -54,6 +55,20 @@ namespace Pinetime {
       };
       static constexpr uint16_t pageSize = 256;
 
+      // Longest read done in a single SPI transaction. It matches the EasyDMA limit of the SPI driver, and
+      // releasing the bus between segments of a long read lets the display driver interleave its own transfers.
+      // Writes aren't split: a full page is programmed in a single operation.
+      static constexpr size_t maxTransferSize = 255;
+
+      // Typical durations from the datasheet. The first status poll happens after this delay,
+      // then the poll interval doubles up to the given maximum until the operation completes.
+      static constexpr uint32_t pageProgramTimeMs = 1;
+      static constexpr uint32_t pageProgramMaxPollMs = 1;
+      static constexpr uint32_t sectorEraseTimeMs = 40;
+      static constexpr uint32_t sectorEraseMaxPollMs = 8;
+
+      void WaitWhileBusy(uint32_t typicalTimeMs, uint32_t maxPollIntervalMs);
+
       Spi& spi;
       Identification device_id;
     };
@@ -177,6 +177,11 @@ void St7789::DrawBuffer(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   WriteSpi(data, size);
 }
 
+void St7789::ContinueDrawBuffer(const uint8_t* data, size_t size) {
+  nrf_gpio_pin_set(pinDataCommand);
+  WriteSpi(data, size);
+}
+
 void St7789::HardwareReset() {
   nrf_gpio_pin_clear(pinReset);
   nrf_delay_ms(10);
@@ -22,6 +22,8 @@ namespace Pinetime {
       void VerticalScrollStartAddress(uint16_t line);
 
       void DrawBuffer(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* data, size_t size);
+      // Sends the next pixels of the window opened by the previous call to DrawBuffer()
+      void ContinueDrawBuffer(const uint8_t* data, size_t size);
 
       void Sleep();
       void Wakeup();
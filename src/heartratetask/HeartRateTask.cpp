@@ -1,12 +1,18 @@
 #include "heartratetask/HeartRateTask.h"
 #include <drivers/Hrs3300.h>
 #include <components/heartrate/HeartRateController.h>
+#include <components/heartrate/HeartRateLog.h>
+#include <components/settings/Settings.h>
+#include <algorithm>
 #include <nrf_log.h>
 
 using namespace Pinetime::Applications;
 
-HeartRateTask::HeartRateTask(Drivers::Hrs3300& heartRateSensor, Controllers::HeartRateController& controller)
-  : heartRateSensor {heartRateSensor}, controller {controller} {
+HeartRateTask::HeartRateTask(Drivers::Hrs3300& heartRateSensor,
+                             Controllers::HeartRateController& controller,
+                             Controllers::Settings& settingsController,
+                             Controllers::HeartRateLog& heartRateLog)
+  : heartRateSensor {heartRateSensor}, controller {controller}, settingsController {settingsController}, heartRateLog {heartRateLog} {
 }
 
 void HeartRateTask::Start() {
@@ -25,10 +31,13 @@ void HeartRateTask::Process(void* instance) {
 
 void HeartRateTask::Work() {
   int lastBpm = 0;
+  lastBackgroundMeasurement = xTaskGetTickCount();
   while (true) {
     Messages msg;
     uint32_t delay;
-    if (state == States::Running) {
+    if (backgroundMeasurementStarted) {
+      delay = ppg.deltaTms;
+    } else if (state == States::Running) {
       if (measurementStarted) {
         delay = ppg.deltaTms;
       } else {
@@ -37,16 +46,25 @@ void HeartRateTask::Work() {
     } else {
       delay = portMAX_DELAY;
     }
+    if (!backgroundMeasurementStarted) {
+      delay = std::min(delay, TicksUntilBackgroundMeasurement());
+    }
 
     if (xQueueReceive(messageQueue, &msg, delay)) {
       switch (msg) {
         case Messages::GoToSleep:
-          StopMeasurement();
+          // A background measurement keeps running while the watch sleeps
+          if (!backgroundMeasurementStarted) {
+            StopMeasurement();
+          }
           state = States::Idle;
           break;
         case Messages::WakeUp:
           state = States::Running;
           if (measurementStarted) {
+            if (backgroundMeasurementStarted) {
+              StopBackgroundMeasurement();
+            }
             lastBpm = 0;
             StartMeasurement();
           }
@@ -55,6 +73,9 @@ void HeartRateTask::Work() {
           if (measurementStarted) {
             break;
           }
+          if (backgroundMeasurementStarted) {
+            StopBackgroundMeasurement();
+          }
           lastBpm = 0;
           StartMeasurement();
           measurementStarted = true;
@@ -63,13 +84,17 @@ void HeartRateTask::Work() {
           if (!measurementStarted) {
             break;
           }
-          StopMeasurement();
+          if (!backgroundMeasurementStarted) {
+            StopMeasurement();
+          }
           measurementStarted = false;
           break;
       }
     }
 
-    if (measurementStarted) {
+    if (backgroundMeasurementStarted) {
+      HandleBackgroundMeasurement();
+    } else if (measurementStarted && state == States::Running) {
       int8_t ambient = ppg.Preprocess(heartRateSensor.ReadHrs(), heartRateSensor.ReadAls());
       int bpm = ppg.HeartRate();
 
@@ -97,6 +122,18 @@ void HeartRateTask::Work() {
         controller.Update(Controllers::HeartRateController::States::Running, lastBpm);
       }
     }
+
+    if (!backgroundMeasurementStarted && TicksUntilBackgroundMeasurement() == 0) {
+      if (measurementStarted && state == States::Running) {
+        // The sensor is already running: log the current value instead of starting a new measurement
+        if (lastBpm > 0) {
+          heartRateLog.Append(lastBpm);
+        }
+        lastBackgroundMeasurement = xTaskGetTickCount();
+      } else {
+        StartBackgroundMeasurement();
+      }
+    }
   }
 }
 
@@ -120,3 +157,52 @@ void HeartRateTask::StopMeasurement() {
   ppg.Reset(true);
   vTaskDelay(100);
 }
+
+void HeartRateTask::StartBackgroundMeasurement() {
+  heartRateSensor.Enable();
+  ppg.SetMode(Controllers::Ppg::Modes::Incremental);
+  ppg.Reset(true);
+  backgroundMeasurementStarted = true;
+  backgroundEstimates = 0;
+  lastBackgroundMeasurement = xTaskGetTickCount();
+  backgroundWindowStart = lastBackgroundMeasurement;
+  vTaskDelay(100);
+}
+
+void HeartRateTask::StopBackgroundMeasurement() {
+  heartRateSensor.Disable();
+  ppg.SetMode(Controllers::Ppg::Modes::Batch);
+  backgroundMeasurementStarted = false;
+}
+
+void HeartRateTask::HandleBackgroundMeasurement() {
+  int8_t ambient = ppg.Preprocess(heartRateSensor.ReadHrs(), heartRateSensor.ReadAls());
+  int bpm = ppg.HeartRate();
+
+  if (ambient > 0) {
+    ppg.Reset(true);
+    backgroundEstimates = 0;
+  } else if (bpm < 0) {
+    ppg.Reset(false);
+    backgroundEstimates = 0;
+  } else if (bpm > 0) {
+    backgroundEstimates++;
+  }
+
+  if (backgroundEstimates >= backgroundEstimatesRequired) {
+    heartRateLog.Append(bpm);
+    StopBackgroundMeasurement();
+  } else if (xTaskGetTickCount() - backgroundWindowStart >= backgroundWindowDuration) {
+    StopBackgroundMeasurement();
+  }
+}
+
+TickType_t HeartRateTask::TicksUntilBackgroundMeasurement() const {
+  const uint16_t interval = settingsController.GetHeartRateBackgroundMeasurementInterval();
+  if (interval == 0) {
+    return portMAX_DELAY;
+  }
+  const TickType_t period = interval * 60 * configTICK_RATE_HZ;
+  const TickType_t elapsed = xTaskGetTickCount() - lastBackgroundMeasurement;
+  return (elapsed >= period) ? 0 : period - elapsed;
+}
@@ -11,6 +11,8 @@ namespace Pinetime {
 
   namespace Controllers {
     class HeartRateController;
+    class HeartRateLog;
+    class Settings;
   }
 
   namespace Applications {
@@ -19,7 +21,10 @@ namespace Pinetime {
       enum class Messages : uint8_t { GoToSleep, WakeUp, StartMeasurement, StopMeasurement };
       enum class States { Idle, Running };
 
-      explicit HeartRateTask(Drivers::Hrs3300& heartRateSensor, Controllers::HeartRateController& controller);
+      HeartRateTask(Drivers::Hrs3300& heartRateSensor,
+                    Controllers::HeartRateController& controller,
+                    Controllers::Settings& settingsController,
+                    Controllers::HeartRateLog& heartRateLog);
       void Start();
       void Work();
       void PushMessage(Messages msg);
@@ -28,14 +33,29 @@ namespace Pinetime {
       static void Process(void* instance);
       void StartMeasurement();
       void StopMeasurement();
+      void StartBackgroundMeasurement();
+      void StopBackgroundMeasurement();
+      void HandleBackgroundMeasurement();
+      TickType_t TicksUntilBackgroundMeasurement() const;
+
+      // A background measurement ends as soon as enough consecutive estimates are available,
+      // or after backgroundWindowDuration if the signal is too noisy.
+      static constexpr TickType_t backgroundWindowDuration = 30 * configTICK_RATE_HZ;
+      static constexpr uint8_t backgroundEstimatesRequired = 4;
 
       TaskHandle_t taskHandle;
       QueueHandle_t messageQueue;
       States state = States::Running;
       Drivers::Hrs3300& heartRateSensor;
       Controllers::HeartRateController& controller;
+      Controllers::Settings& settingsController;
+      Controllers::HeartRateLog& heartRateLog;
       Controllers::Ppg ppg;
       bool measurementStarted = false;
+      bool backgroundMeasurementStarted = false;
+      TickType_t lastBackgroundMeasurement = 0;
+      TickType_t backgroundWindowStart = 0;
+      uint8_t backgroundEstimates = 0;
     };
 
   }
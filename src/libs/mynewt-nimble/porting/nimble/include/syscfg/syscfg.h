@@ -1043,7 +1043,7 @@
 
 /* Overridden by @apache-mynewt-nimble/targets/riot (defined by @apache-mynewt-nimble/nimble/controller) */
 #ifndef MYNEWT_VAL_BLE_LL_CFG_FEAT_DATA_LEN_EXT
-#define MYNEWT_VAL_BLE_LL_CFG_FEAT_DATA_LEN_EXT (0)
+#define MYNEWT_VAL_BLE_LL_CFG_FEAT_DATA_LEN_EXT (1)
 #endif
 
 #ifndef MYNEWT_VAL_BLE_LL_CFG_FEAT_EXT_SCAN_FILT
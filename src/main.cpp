@@ -34,7 +34,10 @@
 #include "components/brightness/BrightnessController.h"
 #include "components/motor/MotorController.h"
 #include "components/datetime/DateTimeController.h"
+#include "components/events/ChangeNotifier.h"
 #include "components/heartrate/HeartRateController.h"
+#include "components/heartrate/HeartRateLog.h"
+#include "components/motion/StepHistory.h"
 #include "components/fs/FS.h"
 #include "drivers/Spi.h"
 #include "drivers/SpiMaster.h"
@@ -90,20 +93,23 @@ Pinetime::Drivers::Hrs3300 heartRateSensor {twiMaster, heartRateSensorTwiAddress
 
 TimerHandle_t debounceTimer;
 TimerHandle_t debounceChargeTimer;
-Pinetime::Controllers::Battery batteryController;
-Pinetime::Controllers::Ble bleController;
+Pinetime::Controllers::ChangeNotifier changeNotifier;
+Pinetime::Controllers::Battery batteryController {changeNotifier};
+Pinetime::Controllers::Ble bleController {changeNotifier};
 
-Pinetime::Controllers::HeartRateController heartRateController;
-Pinetime::Applications::HeartRateTask heartRateApp(heartRateSensor, heartRateController);
+Pinetime::Controllers::HeartRateController heartRateController {changeNotifier};
 
 Pinetime::Controllers::FS fs {spiNorFlash};
 Pinetime::Controllers::Settings settingsController {fs};
 Pinetime::Controllers::MotorController motorController {};
 
-Pinetime::Controllers::DateTime dateTimeController {settingsController};
+Pinetime::Controllers::DateTime dateTimeController {settingsController, changeNotifier};
+Pinetime::Controllers::HeartRateLog heartRateLog {fs, dateTimeController};
+Pinetime::Applications::HeartRateTask heartRateApp(heartRateSensor, heartRateController, settingsController, heartRateLog);
 Pinetime::Drivers::Watchdog watchdog;
-Pinetime::Controllers::NotificationManager notificationManager;
-Pinetime::Controllers::MotionController motionController;
+Pinetime::Controllers::NotificationManager notificationManager {changeNotifier};
+Pinetime::Controllers::MotionController motionController {changeNotifier};
+Pinetime::Controllers::StepHistory stepHistory {fs, dateTimeController};
 Pinetime::Controllers::AlarmController alarmController {dateTimeController};
 Pinetime::Controllers::TouchHandler touchHandler;
 Pinetime::Controllers::ButtonHandler buttonHandler;
@@ -123,7 +129,8 @@ Pinetime::Applications::DisplayApp displayApp(lcd,
                                               alarmController,
                                               brightnessController,
                                               touchHandler,
-                                              fs);
+                                              fs,
+                                              changeNotifier);
 
 Pinetime::System::SystemTask systemTask(spi,
                                         spiNorFlash,
@@ -137,6 +144,8 @@ Pinetime::System::SystemTask systemTask(spi,
                                         notificationManager,
                                         heartRateSensor,
                                         motionController,
+                                        stepHistory,
+                                        heartRateLog,
                                         motionSensor,
                                         settingsController,
                                         heartRateController,
@@ -144,7 +153,8 @@ Pinetime::System::SystemTask systemTask(spi,
                                         heartRateApp,
                                         fs,
                                         touchHandler,
-                                        buttonHandler);
+                                        buttonHandler,
+                                        changeNotifier);
 int mallocFailedCount = 0;
 int stackOverflowCount = 0;
 extern "C" {
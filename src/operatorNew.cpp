@@ -0,0 +1,24 @@
+#include <FreeRTOS.h>
+#include <cstdlib>
+#include <new>
+#include "FreeRTOS/heap_4_infinitime.h"
+
+#if configHEAP_INSTRUMENTATION == 1
+// The allocations made with new are accounted to the caller of new instead of the operator itself
+// (see malloc() in stdlib.c). Like the default operator, fail if the heap is exhausted.
+void* operator new(size_t size) {
+  void* ptr = pvPortMallocFrom(size, __builtin_return_address(0));
+  if (ptr == nullptr) {
+    std::abort();
+  }
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  void* ptr = pvPortMallocFrom(size, __builtin_return_address(0));
+  if (ptr == nullptr) {
+    std::abort();
+  }
+  return ptr;
+}
+#endif
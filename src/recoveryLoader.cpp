@@ -33,7 +33,7 @@ static constexpr uint8_t displayHeight = 240;
 static constexpr uint8_t bytesPerPixel = 2;
 
 static constexpr uint16_t colorWhite = 0xFFFF;
-static constexpr uint16_t colorGreen = 0xE007;
+static constexpr uint16_t colorGreen = 0x07E0;
 
 Pinetime::Drivers::SpiMaster spi {Pinetime::Drivers::SpiMaster::SpiModule::SPI0,
                                   {Pinetime::Drivers::SpiMaster::BitOrder::Msb_Lsb,
@@ -80,7 +80,8 @@ void RefreshWatchdog() {
   NRF_WDT->RR[0] = WDT_RR_RR_Reload;
 }
 
-uint8_t displayBuffer[displayWidth * bytesPerPixel];
+// A line of the logo is decoded while the previous one is drawn
+uint8_t displayBuffer[2][displayWidth * bytesPerPixel];
 
 void Process(void* /*instance*/) {
   RefreshWatchdog();
@@ -122,21 +123,20 @@ void Process(void* /*instance*/) {
 
 void DisplayLogo() {
   Pinetime::Tools::RleDecoder rleDecoder(infinitime_nb, sizeof(infinitime_nb));
-  for (int i = 0; i < displayWidth; i++) {
-    rleDecoder.DecodeNext(displayBuffer, displayWidth * bytesPerPixel);
-    ulTaskNotifyTake(pdTRUE, 500);
-    lcd.DrawBuffer(0, i, displayWidth, 1, reinterpret_cast<const uint8_t*>(displayBuffer), displayWidth * bytesPerPixel);
+  for (int i = 0; i < displayHeight; i++) {
+    uint8_t* line = displayBuffer[i % 2];
+    rleDecoder.DecodeNext(line, displayWidth * bytesPerPixel);
+    // The other buffer may still be drawn
+    gfx.WaitIdle();
+    gfx.FillRectangle(0, i, displayWidth, 1, line);
   }
+  gfx.WaitIdle();
 }
 
 void DisplayProgressBar(uint8_t percent, uint16_t color) {
   static constexpr uint8_t barHeight = 20;
-  std::fill(displayBuffer, displayBuffer + (displayWidth * bytesPerPixel), color);
-  for (int i = 0; i < barHeight; i++) {
-    ulTaskNotifyTake(pdTRUE, 500);
-    uint16_t barWidth = std::min(static_cast<float>(percent) * 2.4f, static_cast<float>(displayWidth));
-    lcd.DrawBuffer(0, displayWidth - barHeight + i, barWidth, 1, reinterpret_cast<const uint8_t*>(displayBuffer), barWidth * bytesPerPixel);
-  }
+  const auto barWidth = static_cast<uint8_t>(std::min(static_cast<float>(percent) * 2.4f, static_cast<float>(displayWidth)));
+  gfx.FillRectangle(0, displayHeight - barHeight, barWidth, barHeight, color);
 }
 
 int mallocFailedCount = 0;
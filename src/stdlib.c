@@ -1,13 +1,23 @@
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include <FreeRTOS.h>
+#include "FreeRTOS/heap_4_infinitime.h"
 
 // Override malloc() and free() to use the memory manager from FreeRTOS.
 // According to the documentation of libc, we also need to override
 // calloc and realloc.
 // See https://www.gnu.org/software/libc/manual/html_node/Replacing-malloc.html
 
+// With the heap instrumentation, the allocations are accounted to the caller of malloc() instead of malloc() itself
+#if configHEAP_INSTRUMENTATION == 1
+  #define HEAP_ALLOCATE(size) pvPortMallocFrom(size, __builtin_return_address(0))
+#else
+  #define HEAP_ALLOCATE(size) pvPortMalloc(size)
+#endif
+
 void* malloc(size_t size) {
-  return pvPortMalloc(size);
+  return HEAP_ALLOCATE(size);
 }
 
 void free(void* ptr) {
@@ -15,13 +25,16 @@ void free(void* ptr) {
 }
 
 void* calloc(size_t num, size_t size) {
-  (void)(num);
-  (void)(size);
-  // Not supported
-  return NULL;
+  if (size != 0 && num > SIZE_MAX / size) {
+    return NULL;
+  }
+  void* ptr = HEAP_ALLOCATE(num * size);
+  if (ptr != NULL) {
+    memset(ptr, 0, num * size);
+  }
+  return ptr;
 }
 
-void *pvPortRealloc(void *ptr, size_t xWantedSize);
 void* realloc( void *ptr, size_t newSize) {
   return pvPortRealloc(ptr, newSize);
 }
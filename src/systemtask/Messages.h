@@ -13,6 +13,7 @@ namespace Pinetime {
       BleConnected,
       BleFirmwareUpdateStarted,
       BleFirmwareUpdateFinished,
+      BleFirmwareUpdateWrite,
       OnTouchEvent,
       HandleButtonEvent,
       HandleButtonTimerEvent,
@@ -4,10 +4,26 @@
   #include <FreeRTOS.h>
   #include <task.h>
   #include <nrf_log.h>
+  #include "FreeRTOS/heap_4_infinitime.h"
 
 void Pinetime::System::SystemMonitor::Process() {
   if (xTaskGetTickCount() - lastTick > 10000) {
     NRF_LOG_INFO("---------------------------------------\nFree heap : %d", xPortGetFreeHeapSize());
+    HeapReport_t heapReport;
+    vPortGetHeapReport(&heapReport);
+    NRF_LOG_INFO("Largest free block : %d - %d free blocks", heapReport.xSizeOfLargestFreeBlockInBytes, heapReport.xNumberOfFreeBlocks);
+  #if configHEAP_INSTRUMENTATION == 1
+    HeapCallSite_t callSites[8];
+    auto nbCallSites = uxPortGetHeapCallSites(callSites, 8);
+    for (size_t i = 0; i < nbCallSites; i++) {
+      NRF_LOG_INFO("Heap [0x%08x] - %d B in %d blocks, peak %d B",
+                   callSites[i].pvCallSite,
+                   callSites[i].xLiveBytes,
+                   callSites[i].ulLiveBlocks,
+                   callSites[i].xPeakLiveBytes);
+    }
+    NRF_LOG_INFO("Heap untracked allocations : %d", xPortGetUntrackedAllocations());
+  #endif
     TaskStatus_t tasksStatus[10];
     auto nb = uxTaskGetSystemState(tasksStatus, 10, nullptr);
     for (uint32_t i = 0; i < nb; i++) {
@@ -44,6 +44,8 @@ SystemTask::SystemTask(Drivers::SpiMaster& spi,
                        Pinetime::Controllers::NotificationManager& notificationManager,
                        Pinetime::Drivers::Hrs3300& heartRateSensor,
                        Pinetime::Controllers::MotionController& motionController,
+                       Pinetime::Controllers::StepHistory& stepHistory,
+                       Pinetime::Controllers::HeartRateLog& heartRateLog,
                        Pinetime::Drivers::Bma421& motionSensor,
                        Controllers::Settings& settingsController,
                        Pinetime::Controllers::HeartRateController& heartRateController,
@@ -51,7 +53,8 @@ SystemTask::SystemTask(Drivers::SpiMaster& spi,
                        Pinetime::Applications::HeartRateTask& heartRateApp,
                        Pinetime::Controllers::FS& fs,
                        Pinetime::Controllers::TouchHandler& touchHandler,
-                       Pinetime::Controllers::ButtonHandler& buttonHandler)
+                       Pinetime::Controllers::ButtonHandler& buttonHandler,
+                       Pinetime::Controllers::ChangeNotifier& changeNotifier)
   : spi {spi},
     spiNorFlash {spiNorFlash},
     twiMaster {twiMaster},
@@ -67,6 +70,8 @@ SystemTask::SystemTask(Drivers::SpiMaster& spi,
     settingsController {settingsController},
     heartRateController {heartRateController},
     motionController {motionController},
+    stepHistory {stepHistory},
+    heartRateLog {heartRateLog},
     displayApp {displayApp},
     heartRateApp(heartRateApp),
     fs {fs},
@@ -80,7 +85,8 @@ SystemTask::SystemTask(Drivers::SpiMaster& spi,
                      spiNorFlash,
                      heartRateController,
                      motionController,
-                     fs) {
+                     fs,
+                     changeNotifier) {
 }
 
 void SystemTask::Start() {
@@ -134,6 +140,8 @@ void SystemTask::Work() {
   motionSensor.Init();
   motionController.Init(motionSensor.DeviceType());
   settingsController.Init();
+  stepHistory.Init();
+  heartRateLog.Init();
 
   displayApp.Register(this);
   displayApp.Register(&nimbleController.weather());
@@ -206,6 +214,8 @@ void SystemTask::Work() {
           }
 
           spiNorFlash.Wakeup();
+          stepHistory.SaveIfChanged();
+          heartRateLog.Flush();
 
           displayApp.PushMessage(Pinetime::Applications::Display::Messages::GoToRunning);
           heartRateApp.PushMessage(Pinetime::Applications::HeartRateTask::Messages::WakeUp);
@@ -268,6 +278,7 @@ void SystemTask::Work() {
           bleDiscoveryTimer = 5;
           break;
         case Messages::BleFirmwareUpdateStarted:
+          nimbleController.StartBulkTransfer();
           doNotGoToSleep = true;
           if (state == SystemTaskState::Sleeping) {
             GoToRunning();
@@ -280,8 +291,12 @@ void SystemTask::Work() {
           }
           doNotGoToSleep = false;
           break;
+        case Messages::BleFirmwareUpdateWrite:
+          nimbleController.dfu().WritePendingData();
+          break;
         case Messages::StartFileTransfer:
           NRF_LOG_INFO("[systemtask] FS Started");
+          nimbleController.StartBulkTransfer();
           doNotGoToSleep = true;
           if (state == SystemTaskState::Sleeping) {
             GoToRunning();
@@ -338,6 +353,11 @@ void SystemTask::Work() {
           stepCounterMustBeReset = true;
           break;
         case Messages::OnNewHour:
+          // The flash is powered down while the watch sleeps: the histories are then saved when it wakes up
+          if (state == SystemTaskState::Running) {
+            stepHistory.SaveIfChanged();
+            heartRateLog.Flush();
+          }
           using Pinetime::Controllers::AlarmController;
           if (settingsController.GetNotificationStatus() != Controllers::Settings::Notification::Sleep &&
               settingsController.GetChimeOption() == Controllers::Settings::ChimesOption::Hours &&
@@ -424,13 +444,19 @@ void SystemTask::UpdateMotion() {
   }
 
   if (stepCounterMustBeReset) {
+    // Record the steps counted since the last update before they are cleared
+    stepHistory.Update(motionSensor.ReadStepCount());
     motionSensor.ResetStepCounter();
     stepCounterMustBeReset = false;
   }
 
   auto motionValues = motionSensor.Process();
+  if (motionValues.nbSamples == 0) {
+    return;
+  }
 
-  motionController.Update(motionValues.x, motionValues.y, motionValues.z, motionValues.steps);
+  motionController.UpdateBatch({motionValues.samples.data(), motionValues.nbSamples}, motionValues.steps);
+  stepHistory.Update(motionValues.steps);
 
   if (settingsController.GetNotificationStatus() != Controllers::Settings::Notification::Sleep) {
     if ((settingsController.isWakeUpModeOn(Pinetime::Controllers::Settings::WakeUpMode::RaiseWrist) &&
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Pinetime {
+  namespace Utility {
+    namespace Rgb565 {
+      // The display expects the most significant byte of each RGB565 pixel first,
+      // while the CPU stores them least significant byte first.
+      constexpr uint16_t ToDisplayOrder(uint16_t color) {
+        return static_cast<uint16_t>((color >> 8) | (color << 8));
+      }
+
+      // Swaps the bytes of both halves of `word`. GCC turns this into a single REV16 instruction.
+      constexpr uint32_t SwapPair(uint32_t word) {
+        return ((word & 0x00ff00ffu) << 8) | ((word >> 8) & 0x00ff00ffu);
+      }
+
+      // Converts `count` pixels in place between native and display byte order, two pixels per iteration.
+      inline void Swap(uint16_t* pixels, size_t count) {
+        if (count > 0 && (reinterpret_cast<uintptr_t>(pixels) & 0x03u) != 0) {
+          *pixels = ToDisplayOrder(*pixels);
+          pixels++;
+          count--;
+        }
+
+        auto* words = reinterpret_cast<uint32_t*>(pixels);
+        for (size_t i = 0; i < count / 2; i++) {
+          words[i] = SwapPair(words[i]);
+        }
+
+        if ((count & 1u) != 0) {
+          pixels[count - 1] = ToDisplayOrder(pixels[count - 1]);
+        }
+      }
+
+      // Fills `count` pixels with `color` (native byte order) converted to display byte order.
+      inline void Fill(uint16_t* pixels, size_t count, uint16_t color) {
+        const uint16_t displayColor = ToDisplayOrder(color);
+        if (count > 0 && (reinterpret_cast<uintptr_t>(pixels) & 0x03u) != 0) {
+          *pixels = displayColor;
+          pixels++;
+          count--;
+        }
+
+        const uint32_t pair = (static_cast<uint32_t>(displayColor) << 16) | displayColor;
+        auto* words = reinterpret_cast<uint32_t*>(pixels);
+        for (size_t i = 0; i < count / 2; i++) {
+          words[i] = pair;
+        }
+
+        if ((count & 1u) != 0) {
+          pixels[count - 1] = displayColor;
+        }
+      }
+    }
+  }
+}
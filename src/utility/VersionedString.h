@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Pinetime {
+  namespace Utility {
+    // String stored inline with a fixed capacity, so that it never allocates from the heap.
+    // The version is incremented each time the string is assigned: readers compare it with the
+    // version they last displayed instead of comparing (and copying) the text.
+    // The string is written by a BLE service and read by the display task. Read Version() before
+    // reading the text: if the text is assigned while it is being read, the version changes again
+    // and the next read gets the complete text.
+    template <size_t Capacity>
+    class VersionedString {
+    public:
+      VersionedString() = default;
+
+      explicit VersionedString(std::string_view text) {
+        Store(text);
+      }
+
+      // Texts longer than the capacity are truncated on a UTF-8 character boundary and end with "..."
+      void Assign(std::string_view text) {
+        Store(text);
+        version.fetch_add(1, std::memory_order_release);
+      }
+
+      std::string_view View() const {
+        return {data.data(), size};
+      }
+
+      const char* CStr() const {
+        return data.data();
+      }
+
+      uint32_t Version() const {
+        return version.load(std::memory_order_acquire);
+      }
+
+      static constexpr size_t capacity = Capacity;
+
+    private:
+      static constexpr std::string_view ellipsis {"..."};
+      static_assert(Capacity > ellipsis.size(), "The capacity must leave room for the ellipsis");
+
+      void Store(std::string_view text) {
+        size_t length = text.size();
+        if (length > Capacity) {
+          length = Capacity - ellipsis.size();
+          while (length > 0 && (static_cast<uint8_t>(text[length]) & 0xc0) == 0x80) {
+            length--;
+          }
+          std::memcpy(data.data(), text.data(), length);
+          std::memcpy(data.data() + length, ellipsis.data(), ellipsis.size());
+          length += ellipsis.size();
+        } else {
+          std::memcpy(data.data(), text.data(), length);
+        }
+        data[length] = '\0';
+        size = length;
+      }
+
+      std::array<char, Capacity + 1> data {};
+      size_t size = 0;
+      std::atomic<uint32_t> version {0};
+    };
+  }
+}